@@ -26,8 +26,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -705,6 +708,14 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 
 static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
                                                       TableFilter &filter) {
+	if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+		// check the full length of the strings against the current constant of the dynamic filter
+		auto constant_filter = filter.Cast<DynamicFilter>().filter_data->GetFilter();
+		if (!constant_filter) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return CheckParquetStringFilter(stats, pq_col_stats, *constant_filter);
+	}
 	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
 		auto &min_value = pq_col_stats.min_value;
@@ -852,6 +863,25 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+template <class FILTER>
+static void FilterSelectionMask(Vector &v, const FILTER &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	sel_count = filter.Filter(v, sel, sel_count, count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < sel_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -989,6 +1019,24 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	case TableFilterType::IS_NULL:
 		FilterIsNull(v, filter_mask, count);
 		break;
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		FilterSelectionMask(v, *bloom_filter.bloom_filter, filter_mask, count);
+		break;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		FilterSelectionMask(v, in_filter, filter_mask, count);
+		break;
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
@@ -22,6 +22,7 @@ def third_party_includes():
     includes += [os.path.join('third_party', 'libpg_query')]
     includes += [os.path.join('third_party', 'libpg_query', 'include')]
     includes += [os.path.join('third_party', 'lz4')]
+    includes += [os.path.join('third_party', 'zstd', 'include')]
     includes += [os.path.join('third_party', 'brotli', 'include')]
     includes += [os.path.join('third_party', 'brotli', 'common')]
     includes += [os.path.join('third_party', 'brotli', 'dec')]
@@ -44,6 +45,8 @@ def third_party_sources():
     sources = []
     sources += [os.path.join('third_party', 'fmt')]
     sources += [os.path.join('third_party', 'fsst')]
+    sources += [os.path.join('third_party', 'lz4')]
+    sources += [os.path.join('third_party', 'zstd')]
     sources += [os.path.join('third_party', 'miniz')]
     sources += [os.path.join('third_party', 're2')]
     sources += [os.path.join('third_party', 'hyperloglog')]
@@ -523,6 +523,21 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 #endif
 }
 
+void LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// this is only a hint - we ignore any errors
+	int fd = handle.Cast<UnixFileHandle>().fd;
+#if defined(__linux__)
+	posix_fadvise(fd, UnsafeNumericCast<off_t>(location), UnsafeNumericCast<off_t>(nr_bytes), POSIX_FADV_WILLNEED);
+#elif defined(__APPLE__)
+	struct radvisory advice;
+	advice.ra_offset = UnsafeNumericCast<off_t>(location);
+	advice.ra_count = UnsafeNumericCast<int>(MinValue<idx_t>(nr_bytes, NumericLimits<int>::Maximum()));
+	fcntl(fd, F_RDADVISE, &advice);
+#else
+	(void)fd;
+#endif
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	struct stat s;
@@ -963,6 +978,11 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 	return false;
 }
 
+void LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// Windows has no read-ahead hint for (unmapped) file handles - the blocks are read when they are pinned
+	FileSystem::ReadAhead(handle, location, nr_bytes);
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	LARGE_INTEGER result;
@@ -15,8 +15,8 @@ uint32_t ChunkReference::GetMinimumBlockID() const {
 	return *std::min_element(block_ids.begin(), block_ids.end());
 }
 
-ColumnDataConsumer::ColumnDataConsumer(ColumnDataCollection &collection_p, vector<column_t> column_ids)
-    : collection(collection_p), column_ids(std::move(column_ids)) {
+ColumnDataConsumer::ColumnDataConsumer(ColumnDataCollection &collection_p, vector<column_t> column_ids, bool consume)
+    : collection(collection_p), column_ids(std::move(column_ids)), consume(consume) {
 }
 
 void ColumnDataConsumer::InitializeScan() {
@@ -75,6 +75,9 @@ void ColumnDataConsumer::FinishChunk(ColumnDataConsumerScanState &state) {
 	ConsumeChunks(delete_index_start, delete_index_end);
 }
 void ColumnDataConsumer::ConsumeChunks(idx_t delete_index_start, idx_t delete_index_end) {
+	if (!consume) {
+		return;
+	}
 	for (idx_t chunk_index = delete_index_start; chunk_index < delete_index_end; chunk_index++) {
 		if (chunk_index == 0) {
 			continue;
@@ -903,7 +903,7 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 
 	if (scan_state.values[1].IsNull()) {
 		// Single predicate.
-		lock_guard<mutex> l(lock);
+		auto shared_lock = lock.GetSharedLock();
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			return SearchEqual(key, max_count, row_ids);
@@ -921,7 +921,7 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	}
 
 	// Two predicates.
-	lock_guard<mutex> l(lock);
+	auto shared_lock = lock.GetSharedLock();
 	D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 	auto upper_bound = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[1]);
 	bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
@@ -929,6 +929,61 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	return SearchCloseRange(key, upper_bound, left_equal, right_equal, max_count, row_ids);
 }
 
+bool ART::ScanOrdered(ARTOrderedScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	if (state.finished) {
+		return false;
+	}
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	ARTKey upper_bound;
+	if (!state.upper_bound.IsNull()) {
+		D_ASSERT(state.upper_bound.type().InternalType() == types[0]);
+		upper_bound = ARTKey::CreateKey(arena_allocator, types[0], state.upper_bound);
+	}
+
+	auto shared_lock = lock.GetSharedLock();
+	if (!tree.HasMetadata()) {
+		state.finished = true;
+		return false;
+	}
+
+	// We do not keep the iterator between batches, as the ART can change in the meantime.
+	// Instead, we find the first key greater than the last key of the previous batch.
+	Iterator it(*this);
+	bool found;
+	if (!state.last_key.empty()) {
+		ARTKey last_key(state.last_key.data(), state.last_key.size());
+		found = it.LowerBound(tree, last_key, false, 0);
+	} else if (!state.lower_bound.IsNull()) {
+		D_ASSERT(state.lower_bound.type().InternalType() == types[0]);
+		auto lower_bound = ARTKey::CreateKey(arena_allocator, types[0], state.lower_bound);
+		found = it.LowerBound(tree, lower_bound, state.lower_equal, 0);
+	} else {
+		it.FindMinimum(tree);
+		found = true;
+	}
+	if (!found || !it.ScanBatch(upper_bound, state.upper_equal, max_count, row_ids, state.last_key)) {
+		state.finished = true;
+	}
+	return !state.finished;
+}
+
+void ART::SearchEqual(DataChunk &input, vector<unsafe_vector<row_t>> &row_ids) {
+	D_ASSERT(input.ColumnCount() == 1);
+	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
+	unsafe_vector<ARTKey> keys(input.size());
+	GenerateKeys<>(arena_allocator, input, keys);
+
+	row_ids.resize(input.size());
+	auto shared_lock = lock.GetSharedLock();
+	for (idx_t i = 0; i < input.size(); i++) {
+		row_ids[i].clear();
+		if (keys[i].Empty()) {
+			continue;
+		}
+		SearchEqual(keys[i], NumericLimits<idx_t>::Maximum(), row_ids[i]);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // More Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -976,9 +1031,6 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 }
 
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
-	// Lock the index during constraint checking.
-	lock_guard<mutex> l(lock);
-
 	DataChunk expr_chunk;
 	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
 	ExecuteExpressions(input, expr_chunk);
@@ -987,6 +1039,9 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	unsafe_vector<ARTKey> keys(expr_chunk.size());
 	GenerateKeys<>(arena_allocator, expr_chunk, keys);
 
+	// Constraint checks only read the index, so they can run in parallel with each other.
+	auto shared_lock = lock.GetSharedLock();
+
 	auto found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 		if (keys[i].Empty()) {
@@ -24,7 +24,10 @@ bool IteratorKey::Contains(const ARTKey &key) const {
 }
 
 bool IteratorKey::GreaterThan(const ARTKey &key, const bool equal, const uint8_t nested_depth) const {
-	for (idx_t i = 0; i < MinValue<idx_t>(Size(), key.len); i++) {
+	// We do not compare the bytes of a nested leaf.
+	D_ASSERT(Size() >= nested_depth);
+	auto this_len = Size() - nested_depth;
+	for (idx_t i = 0; i < MinValue<idx_t>(this_len, key.len); i++) {
 		if (key_bytes[i] > key.data[i]) {
 			return true;
 		} else if (key_bytes[i] < key.data[i]) {
@@ -33,8 +36,6 @@ bool IteratorKey::GreaterThan(const ARTKey &key, const bool equal, const uint8_t
 	}
 
 	// Returns true, if current_key is greater than (or equal to) key.
-	D_ASSERT(Size() >= nested_depth);
-	auto this_len = Size() - nested_depth;
 	return equal ? this_len > key.len : this_len >= key.len;
 }
 
@@ -52,43 +53,84 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vec
 			}
 		}
 
-		switch (last_leaf.GetType()) {
-		case NType::LEAF_INLINED:
+		if (!GetRowIds(max_count, row_ids)) {
+			return false;
+		}
+
+		has_next = Next();
+	} while (has_next);
+	return true;
+}
+
+bool Iterator::GetRowIds(const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	switch (last_leaf.GetType()) {
+	case NType::LEAF_INLINED:
+		if (row_ids.size() + 1 > max_count) {
+			return false;
+		}
+		row_ids.push_back(last_leaf.GetRowId());
+		break;
+	case NType::LEAF:
+		if (!Leaf::DeprecatedGetRowIds(art, last_leaf, row_ids, max_count)) {
+			return false;
+		}
+		break;
+	case NType::NODE_7_LEAF:
+	case NType::NODE_15_LEAF:
+	case NType::NODE_256_LEAF: {
+		uint8_t byte = 0;
+		while (last_leaf.GetNextByte(art, byte)) {
 			if (row_ids.size() + 1 > max_count) {
 				return false;
 			}
-			row_ids.push_back(last_leaf.GetRowId());
-			break;
-		case NType::LEAF:
-			if (!Leaf::DeprecatedGetRowIds(art, last_leaf, row_ids, max_count)) {
-				return false;
+			row_id[ROW_ID_SIZE - 1] = byte;
+			ARTKey key(&row_id[0], ROW_ID_SIZE);
+			row_ids.push_back(key.GetRowId());
+			if (byte == NumericLimits<uint8_t>::Maximum()) {
+				break;
 			}
-			break;
-		case NType::NODE_7_LEAF:
-		case NType::NODE_15_LEAF:
-		case NType::NODE_256_LEAF: {
-			uint8_t byte = 0;
-			while (last_leaf.GetNextByte(art, byte)) {
-				if (row_ids.size() + 1 > max_count) {
-					return false;
-				}
-				row_id[ROW_ID_SIZE - 1] = byte;
-				ARTKey key(&row_id[0], ROW_ID_SIZE);
-				row_ids.push_back(key.GetRowId());
-				if (byte == NumericLimits<uint8_t>::Maximum()) {
-					break;
-				}
-				byte++;
+			byte++;
+		}
+		break;
+	}
+	default:
+		throw InternalException("Invalid leaf type for index scan.");
+	}
+	return true;
+}
+
+bool Iterator::ScanBatch(const ARTKey &upper_bound, const bool equal, const idx_t max_count,
+                         unsafe_vector<row_t> &row_ids, unsafe_vector<uint8_t> &last_key) {
+	bool batch_full = false;
+	do {
+		auto key_len = GetKeyLength();
+		if (batch_full) {
+			// We only stop at the end of a key, so that the next batch can continue after last_key.
+			bool same_key = key_len == last_key.size();
+			for (idx_t i = 0; same_key && i < key_len; i++) {
+				same_key = current_key[i] == last_key[i];
+			}
+			if (!same_key) {
+				return true;
 			}
-			break;
 		}
-		default:
-			throw InternalException("Invalid leaf type for index scan.");
+
+		// An empty upper bound indicates that no upper bound exists.
+		auto key_nested_depth = status == GateStatus::GATE_SET ? nested_depth : uint8_t(0);
+		if (!upper_bound.Empty() && current_key.GreaterThan(upper_bound, equal, key_nested_depth)) {
+			return false;
 		}
 
-		has_next = Next();
-	} while (has_next);
-	return true;
+		GetRowIds(NumericLimits<idx_t>::Maximum(), row_ids);
+		if (!batch_full && row_ids.size() >= max_count) {
+			batch_full = true;
+			last_key.resize(key_len);
+			for (idx_t i = 0; i < key_len; i++) {
+				last_key[i] = current_key[i];
+			}
+		}
+	} while (Next());
+	return false;
 }
 
 void Iterator::FindMinimum(const Node &node) {
@@ -36,15 +36,17 @@ void Node256Leaf::DeleteByte(ART &art, Node &node, const uint8_t byte) {
 	}
 }
 
-bool Node256Leaf::HasByte(uint8_t &byte) {
-	ValidityMask v_mask(&mask[0]);
-	return v_mask.RowIsValid(byte);
+bool Node256Leaf::HasByte(uint8_t &byte) const {
+	idx_t entry_idx, idx_in_entry;
+	ValidityMask::GetEntryIndex(byte, entry_idx, idx_in_entry);
+	return ValidityMask::RowIsValid(mask[entry_idx], idx_in_entry);
 }
 
-bool Node256Leaf::GetNextByte(uint8_t &byte) {
-	ValidityMask v_mask(&mask[0]);
+bool Node256Leaf::GetNextByte(uint8_t &byte) const {
+	idx_t entry_idx, idx_in_entry;
 	for (uint16_t i = byte; i < CAPACITY; i++) {
-		if (v_mask.RowIsValid(i)) {
+		ValidityMask::GetEntryIndex(i, entry_idx, idx_in_entry);
+		if (ValidityMask::RowIsValid(mask[entry_idx], idx_in_entry)) {
 			byte = UnsafeNumericCast<uint8_t>(i);
 			return true;
 		}
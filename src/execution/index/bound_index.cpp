@@ -29,7 +29,7 @@ BoundIndex::BoundIndex(const string &name, const string &index_type, IndexConstr
 }
 
 void BoundIndex::InitializeLock(IndexLock &state) {
-	state.index_lock = unique_lock<mutex>(lock);
+	state.index_lock = lock.GetExclusiveLock();
 }
 
 ErrorData BoundIndex::Append(DataChunk &entries, Vector &row_identifiers) {
@@ -81,6 +81,7 @@ idx_t BoundIndex::GetInMemorySize() {
 }
 
 void BoundIndex::ExecuteExpressions(DataChunk &input, DataChunk &result) {
+	lock_guard<mutex> l(executor_lock);
 	executor.Execute(input, result);
 }
 
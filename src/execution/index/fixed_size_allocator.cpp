@@ -6,7 +6,7 @@ namespace duckdb {
 
 FixedSizeAllocator::FixedSizeAllocator(const idx_t segment_size, BlockManager &block_manager)
     : block_manager(block_manager), buffer_manager(block_manager.buffer_manager), segment_size(segment_size),
-      total_segment_count(0) {
+      total_segment_count(0), unloaded_buffer_count(0) {
 
 	if (segment_size > block_manager.GetBlockSize() - sizeof(validity_t)) {
 		throw InternalException("The maximum segment size of fixed-size allocators is " +
@@ -84,6 +84,9 @@ IndexPointer FixedSizeAllocator::New() {
 	}
 
 	// zero-initialize that segment
+	if (unloaded_buffer_count != 0) {
+		LoadBuffer(buffer);
+	}
 	auto buffer_ptr = buffer.Get();
 	auto offset_in_buffer = buffer_ptr + offset * segment_size + bitmask_offset;
 	memset(offset_in_buffer, 0, segment_size);
@@ -98,6 +101,9 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 
 	D_ASSERT(buffers.find(buffer_id) != buffers.end());
 	auto &buffer = buffers.find(buffer_id)->second;
+	if (unloaded_buffer_count != 0) {
+		LoadBuffer(buffer);
+	}
 
 	auto bitmask_ptr = reinterpret_cast<validity_t *>(buffer.Get());
 	ValidityMask mask(bitmask_ptr);
@@ -120,6 +126,7 @@ void FixedSizeAllocator::Reset() {
 	buffers.clear();
 	buffers_with_free_space.clear();
 	total_segment_count = 0;
+	unloaded_buffer_count = 0;
 }
 
 idx_t FixedSizeAllocator::GetInMemorySize() const {
@@ -143,24 +150,30 @@ idx_t FixedSizeAllocator::GetUpperBoundBufferId() const {
 }
 
 void FixedSizeAllocator::Merge(FixedSizeAllocator &other) {
+	// remember the buffer count and merge the buffers
+	Merge(other, GetUpperBoundBufferId());
+}
+
+void FixedSizeAllocator::Merge(FixedSizeAllocator &other, const idx_t buffer_id_offset) {
 
 	D_ASSERT(segment_size == other.segment_size);
 
-	// remember the buffer count and merge the buffers
-	idx_t upper_bound_id = GetUpperBoundBufferId();
 	for (auto &buffer : other.buffers) {
-		buffers.insert(make_pair(buffer.first + upper_bound_id, std::move(buffer.second)));
+		D_ASSERT(buffers.find(buffer.first + buffer_id_offset) == buffers.end());
+		buffers.insert(make_pair(buffer.first + buffer_id_offset, std::move(buffer.second)));
 	}
 	other.buffers.clear();
 
 	// merge the buffers with free spaces
 	for (auto &buffer_id : other.buffers_with_free_space) {
-		buffers_with_free_space.insert(buffer_id + upper_bound_id);
+		buffers_with_free_space.insert(buffer_id + buffer_id_offset);
 	}
 	other.buffers_with_free_space.clear();
 
 	// add the total allocations
 	total_segment_count += other.total_segment_count;
+	unloaded_buffer_count += other.unloaded_buffer_count;
+	other.unloaded_buffer_count = 0;
 }
 
 bool FixedSizeAllocator::InitializeVacuum() {
@@ -276,6 +289,7 @@ void FixedSizeAllocator::SerializeBuffers(PartialBlockManager &partial_block_man
 	for (auto &buffer : buffers) {
 		buffer.second.Serialize(partial_block_manager, available_segments_per_buffer, segment_size, bitmask_offset);
 	}
+	CountUnloadedBuffers();
 }
 
 vector<IndexBufferInfo> FixedSizeAllocator::InitSerializationToWAL() {
@@ -285,6 +299,7 @@ vector<IndexBufferInfo> FixedSizeAllocator::InitSerializationToWAL() {
 		buffer.second.SetAllocationSize(available_segments_per_buffer, segment_size, bitmask_offset);
 		buffer_infos.emplace_back(buffer.second.Get(), buffer.second.allocation_size);
 	}
+	CountUnloadedBuffers();
 	return buffer_infos;
 }
 
@@ -310,6 +325,7 @@ void FixedSizeAllocator::Init(const FixedSizeAllocatorInfo &info) {
 	for (const auto &buffer_id : info.buffers_with_free_space) {
 		buffers_with_free_space.insert(buffer_id);
 	}
+	CountUnloadedBuffers();
 }
 
 void FixedSizeAllocator::Deserialize(MetadataManager &metadata_manager, const BlockPointer &block_pointer) {
@@ -333,6 +349,7 @@ void FixedSizeAllocator::Deserialize(MetadataManager &metadata_manager, const Bl
 	for (idx_t i = 0; i < buffers_with_free_space_count; i++) {
 		buffers_with_free_space.insert(reader.Read<idx_t>());
 	}
+	CountUnloadedBuffers();
 }
 
 idx_t FixedSizeAllocator::GetAvailableBufferId() const {
@@ -357,6 +374,26 @@ void FixedSizeAllocator::RemoveEmptyBuffers() {
 		buffer_it->second.Destroy();
 		buffer_it = buffers.erase(buffer_it);
 	}
+	CountUnloadedBuffers();
+}
+
+void FixedSizeAllocator::LoadBuffer(FixedSizeBuffer &buffer) {
+	lock_guard<mutex> l(load_lock);
+	if (!buffer.InMemory()) {
+		buffer.Pin();
+		D_ASSERT(unloaded_buffer_count > 0);
+		unloaded_buffer_count--;
+	}
+}
+
+void FixedSizeAllocator::CountUnloadedBuffers() {
+	idx_t count = 0;
+	for (auto &buffer : buffers) {
+		if (!buffer.second.InMemory()) {
+			count++;
+		}
+	}
+	unloaded_buffer_count = count;
 }
 
 } // namespace duckdb
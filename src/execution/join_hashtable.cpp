@@ -1,10 +1,12 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -132,12 +134,12 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const idx_t &bitmask) {
+static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const JoinHashTable &ht) {
 	if (hashes_v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		D_ASSERT(!ConstantVector::IsNull(hashes_v));
 		auto indices = ConstantVector::GetData<hash_t>(hashes_v);
 		hash_t salt = ht_entry_t::ExtractSaltWithNulls(*indices);
-		idx_t offset = *indices & bitmask;
+		idx_t offset = ht.GetPointerTableOffset(*indices);
 		*indices = offset | salt;
 		hashes_v.Flatten(count);
 	} else {
@@ -145,7 +147,7 @@ static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, co
 		auto hashes = FlatVector::GetData<hash_t>(hashes_v);
 		for (idx_t i = 0; i < count; i++) {
 			idx_t salt = ht_entry_t::ExtractSaltWithNulls(hashes[i]);
-			idx_t offset = hashes[i] & bitmask;
+			idx_t offset = ht.GetPointerTableOffset(hashes[i]);
 			hashes[i] = offset | salt;
 		}
 	}
@@ -169,13 +171,15 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 
 	idx_t non_empty_count = 0;
 
-	// first, filter out the empty rows and calculate the offset
+	// first, calculate the offsets and prefetch the entries: the bucket heads of the whole batch are requested before
+	// the dense loop below touches the first one, so the cache misses overlap instead of stalling one by one
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
-		auto ht_offset = hashes[uvf_index] & ht->bitmask;
+		auto ht_offset = ht->GetPointerTableOffset(hashes[uvf_index]);
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
+		DUCKDB_PREFETCH(entries + ht_offset);
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
@@ -257,6 +261,11 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 		}
 
 		if (salt_match_count != 0) {
+			// Prefetch the rows of all salt matches before comparing any keys, for the same reason as above
+			for (idx_t i = 0; i < salt_match_count; i++) {
+				DUCKDB_PREFETCH(row_ptr_insert_to[state.salt_match_sel.get_index(i)]);
+			}
+
 			// Perform row comparisons, after function call salt_match_sel will point to the keys that match
 			idx_t key_match_count = ht->row_matcher_build.Match(keys, key_state.vector_data, state.salt_match_sel,
 			                                                    salt_match_count, ht->layout, state.rhs_row_locations,
@@ -401,6 +410,11 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// note that we only hash the keys used in the equality comparison
 	Hash(keys, *current_sel, added_count, hash_values);
 
+	if (CanSplitRounds()) {
+		// keep track of the most frequent keys, so that we know which partitions are skewed if we go external
+		heavy_hitters.Sample(hash_values, *current_sel, added_count);
+	}
+
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
@@ -409,6 +423,62 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	sink_collection->AppendUnified(append_state, source_chunk, *current_sel, added_count);
 }
 
+void JoinHashTable::HeavyHitters::Sample(Vector &hashes, const SelectionVector &sel, idx_t count) {
+	UnifiedVectorFormat hash_data;
+	hashes.ToUnifiedFormat(count, hash_data);
+	const auto hash_ptr = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+
+	idx_t i;
+	for (i = sample_offset; i < count; i += SAMPLE_RATE) {
+		Add(hash_ptr[hash_data.sel->get_index(sel.get_index(i))], 1);
+		sample_count++;
+	}
+	sample_offset = i - count;
+}
+
+void JoinHashTable::HeavyHitters::Combine(const HeavyHitters &other) {
+	for (idx_t i = 0; i < other.size; i++) {
+		Add(other.hashes[i], other.counts[i]);
+	}
+	sample_count += other.sample_count;
+}
+
+void JoinHashTable::HeavyHitters::Add(hash_t hash, idx_t increment) {
+	// find the hash, or the entry with the lowest count
+	idx_t min_idx = 0;
+	for (idx_t i = 0; i < size; i++) {
+		if (hashes[i] == hash) {
+			counts[i] += increment;
+			return;
+		}
+		if (counts[i] < counts[min_idx]) {
+			min_idx = i;
+		}
+	}
+	if (size < CAPACITY) {
+		hashes[size] = hash;
+		counts[size++] = increment;
+		return;
+	}
+	// the sketch is full: the entry with the lowest count is replaced, and the new hash inherits its count
+	hashes[min_idx] = hash;
+	counts[min_idx] += increment;
+}
+
+idx_t JoinHashTable::HeavyHitters::EstimateCount(idx_t radix_bits, idx_t partition_idx) const {
+	// the count of a monitored hash is overestimated by at most sample_count / CAPACITY
+	const auto max_error = sample_count / CAPACITY;
+	const auto mask = RadixPartitioning::Mask(radix_bits);
+	const auto shift = RadixPartitioning::Shift(radix_bits);
+	idx_t result = 0;
+	for (idx_t i = 0; i < size; i++) {
+		if (counts[i] > max_error && ((hashes[i] & mask) >> shift) == partition_idx) {
+			result += (counts[i] - max_error) * SAMPLE_RATE;
+		}
+	}
+	return result;
+}
+
 idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat> &vector_data,
                                  const SelectionVector *&current_sel, SelectionVector &sel, bool build_side) {
 	// figure out which keys are NULL, and create a selection vector out of them
@@ -555,7 +625,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
                              JoinHashTable::InsertState &state, const TupleDataCollection &data_collection,
                              JoinHashTable &ht) {
 	D_ASSERT(hashes_v.GetType().id() == LogicalType::HASH);
-	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht.bitmask);
+	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht);
 
 	// the offset for each row to insert
 	const auto ht_offsets_and_salts = FlatVector::GetData<idx_t>(hashes_v);
@@ -593,8 +663,8 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 		}
 	}
 
-	// use the ht bitmask to make the modulo operation faster but keep the salt bits intact
-	idx_t capacity_mask = ht.bitmask | ht_entry_t::SALT_MASK;
+	// use the ht bitmask to make the modulo operation faster (IncrementAndWrap keeps the salt bits intact)
+	idx_t capacity_mask = ht.bitmask;
 	while (remaining_count > 0) {
 		idx_t salt_match_count = 0;
 
@@ -680,7 +750,7 @@ void JoinHashTable::InsertHashes(Vector &hashes_v, const idx_t count, TupleDataC
 }
 
 void JoinHashTable::InitializePointerTable() {
-	capacity = PointerTableCapacity(Count());
+	capacity = PointerTableCapacity(split_round ? GetSplitCount() : Count());
 	D_ASSERT(IsPowerOfTwo(capacity));
 
 	if (hash_map.get()) {
@@ -701,13 +771,69 @@ void JoinHashTable::InitializePointerTable() {
 	}
 	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
 
+	// divide the pointer table into regions (one per partition) if we know the partitions of the data collection
+	// the regions can then be built independently of each other, i.e., without any synchronization
+	// we merge neighbouring partitions until the rows of every region fit comfortably in its part of the pointer table
+	region_radix_bits = partition_counts.empty() ? 0 : radix_bits;
+	while (region_radix_bits > 0) {
+		const auto region_capacity = capacity >> region_radix_bits;
+		const auto partitions_per_region = RadixPartitioning::NumberOfPartitions(radix_bits - region_radix_bits);
+		idx_t max_region_count = 0;
+		for (idx_t partition_idx = 0; partition_idx < partition_counts.size(); partition_idx += partitions_per_region) {
+			idx_t region_count = 0;
+			for (idx_t i = partition_idx; i < partition_idx + partitions_per_region; i++) {
+				region_count += partition_counts[i];
+			}
+			max_region_count = MaxValue(max_region_count, region_count);
+		}
+		// allow a load factor of 75% in the fullest region (the average load factor is at most 50%)
+		if (region_capacity >= 1024 && max_region_count * 4 <= region_capacity * 3) {
+			break;
+		}
+		region_radix_bits--;
+	}
+	if (region_radix_bits > 0) {
+		region_mask = RadixPartitioning::Mask(region_radix_bits);
+		// move the radix bits from their position in the hash to the most significant bits of the offset
+		region_shift = RadixPartitioning::Shift(region_radix_bits) - (CountZeros<uint64_t>::Trailing(capacity) -
+		                                                              region_radix_bits);
+	} else {
+		region_mask = 0;
+		region_shift = 0;
+	}
+
 	// initialize HT with all-zero entries
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
 
-	bitmask = capacity - 1;
+	bitmask = (capacity >> region_radix_bits) - 1;
+}
+
+void JoinHashTable::GetBuildChunkRange(idx_t &chunk_idx_from, idx_t &chunk_idx_to) const {
+	if (split_round) {
+		chunk_idx_from = split_chunk_start;
+		chunk_idx_to = split_chunk_end;
+	} else {
+		chunk_idx_from = 0;
+		chunk_idx_to = data_collection->ChunkCount();
+	}
 }
 
-void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
+void JoinHashTable::GetRegionChunkRange(idx_t region_idx_from, idx_t region_idx_to, idx_t &chunk_idx_from,
+                                        idx_t &chunk_idx_to) const {
+	D_ASSERT(region_radix_bits > 0 && region_idx_from <= region_idx_to && region_idx_to <= GetRegionCount());
+	// the partitions are stored consecutively in the data collection
+	const auto partitions_per_region = RadixPartitioning::NumberOfPartitions(radix_bits - region_radix_bits);
+	chunk_idx_from = 0;
+	chunk_idx_to = 0;
+	for (idx_t partition_idx = 0; partition_idx < region_idx_to * partitions_per_region; partition_idx++) {
+		if (partition_idx < region_idx_from * partitions_per_region) {
+			chunk_idx_from += partition_chunk_counts[partition_idx];
+		}
+		chunk_idx_to += partition_chunk_counts[partition_idx];
+	}
+}
+
+void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel, bool partitioned) {
 	// Pointer table should be allocated
 	D_ASSERT(hash_map.get());
 
@@ -724,9 +850,13 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// the hashes are overwritten by InsertHashes - add them to the bloom filter first
+			bloom_filter->Insert(hashes, count, parallel);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
-		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
+		InsertHashes(hashes, count, chunk_state, insert_state, parallel && !partitioned);
 	} while (iterator.Next());
 }
 
@@ -876,9 +1006,10 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, const idx_t sel_
 	for (idx_t i = 0; i < sel_count; i++) {
 		auto idx = sel.get_index(i);
 		ptrs[idx] = LoadPointer(ptrs[idx] + ht.pointer_offset);
-		if (ptrs[idx]) {
-			this->sel_vector.set_index(new_count++, idx);
-		}
+		// the keys of the next row in the chain are compared right after this loop
+		DUCKDB_PREFETCH(ptrs[idx]);
+		this->sel_vector.set_index(new_count, idx);
+		new_count += ptrs[idx] != nullptr;
 	}
 	this->count = new_count;
 }
@@ -1346,11 +1477,20 @@ idx_t JoinHashTable::GetTotalSize(const vector<idx_t> &partition_sizes, const ve
 		total_size += partition_sizes[i];
 		total_count += partition_counts[i];
 
-		auto partition_size = partition_sizes[i] + PointerTableSize(partition_counts[i]);
+		auto size = partition_sizes[i];
+		auto count = partition_counts[i];
+		if (CanSplitRounds() && count != 0) {
+			// the rows of a heavy hitter always end up in the same partition, so repartitioning does not help
+			// if a partition does not fit because of heavy hitters, it is built in multiple parts instead
+			const auto heavy_count = MinValue(heavy_hitters.EstimateCount(radix_bits, i), count);
+			size -= size / count * heavy_count;
+			count -= heavy_count;
+		}
+		auto partition_size = size + PointerTableSize(count);
 		if (partition_size > max_partition_ht_size) {
 			max_partition_ht_size = partition_size;
-			max_partition_size = partition_sizes[i];
-			max_partition_count = partition_counts[i];
+			max_partition_size = size;
+			max_partition_count = count;
 		}
 	}
 
@@ -1388,6 +1528,14 @@ idx_t JoinHashTable::GetRemainingSize() const {
 }
 
 void JoinHashTable::Unpartition() {
+	// the partitions are combined in order - keep track of where they end up so we can build the HT by partition
+	auto &partitions = sink_collection->GetPartitions();
+	partition_chunk_counts.clear();
+	partition_counts.clear();
+	for (auto &partition : partitions) {
+		partition_chunk_counts.push_back(partition->ChunkCount());
+		partition_counts.push_back(partition->Count());
+	}
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
@@ -1427,9 +1575,42 @@ void JoinHashTable::Reset() {
 	data_collection->Reset();
 	hash_map.Reset();
 	finalized = false;
+	split_round = false;
+}
+
+idx_t JoinHashTable::GetSplitCount() const {
+	// a chunk holds at most STANDARD_VECTOR_SIZE rows
+	return MinValue<idx_t>((split_chunk_end - split_chunk_start) * STANDARD_VECTOR_SIZE, Count());
+}
+
+idx_t JoinHashTable::GetSplitChunkEnd(const idx_t max_ht_size) const {
+	// estimate the size of a range of chunks using the average size of a chunk
+	const auto chunk_count = data_collection->ChunkCount();
+	const auto chunk_size = (SizeInBytes() + chunk_count - 1) / chunk_count;
+
+	// at least one chunk
+	auto chunk_idx_to = split_chunk_start + 1;
+	for (; chunk_idx_to < chunk_count; chunk_idx_to++) {
+		const auto part_chunk_count = chunk_idx_to + 1 - split_chunk_start;
+		const auto part_count = MinValue<idx_t>(part_chunk_count * STANDARD_VECTOR_SIZE, Count());
+		if (part_chunk_count * chunk_size + PointerTableSize(part_count) > max_ht_size) {
+			break;
+		}
+	}
+	return chunk_idx_to;
 }
 
 bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
+	if (!IsLastPart()) {
+		// Build the next part of the partitions of the current round, the previous part no longer has to be pinned
+		data_collection->Unpin();
+		finalized = false;
+		split_chunk_start = split_chunk_end;
+		split_chunk_end = GetSplitChunkEnd(max_ht_size);
+		return true;
+	}
+	split_round = false;
+
 	if (finalized) {
 		Reset();
 	}
@@ -1442,6 +1623,9 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	// Start where we left off
 	auto &partitions = sink_collection->GetPartitions();
 	partition_start = partition_end;
+	// we only build pointer tables by partition for in-memory hash joins
+	partition_chunk_counts.clear();
+	partition_counts.clear();
 
 	// Determine how many partitions we can do next (at least one)
 	idx_t count = 0;
@@ -1465,9 +1649,36 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 	D_ASSERT(Count() == count);
 
+	if (data_size + PointerTableSize(count) > max_ht_size && data_collection->ChunkCount() > 1 && CanSplitRounds()) {
+		// The partition does not fit (even after repartitioning, e.g., because of a heavy hitter), build it in parts
+		split_round = true;
+		split_chunk_start = 0;
+		split_chunk_end = GetSplitChunkEnd(max_ht_size);
+		if (split_chunk_end == data_collection->ChunkCount()) {
+			split_round = false;
+		}
+	}
+
 	return true;
 }
 
+void JoinHashTable::PrepareExternalScan(const idx_t partition_end_p) {
+	Reset();
+
+	D_ASSERT(partition_end_p > partition_end);
+	D_ASSERT(partition_end_p <= RadixPartitioning::NumberOfPartitions(radix_bits));
+	partition_start = partition_end;
+	partition_end = partition_end_p;
+	partition_chunk_counts.clear();
+	partition_counts.clear();
+
+	// Move the partitions to the main data collection
+	auto &partitions = sink_collection->GetPartitions();
+	for (idx_t partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
+		data_collection->Combine(*partitions[partition_idx]);
+	}
+}
+
 static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk &payload, Vector &hashes) {
 	spill_chunk.Reset();
 	idx_t spill_col_idx = 0;
@@ -1480,6 +1691,7 @@ static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk
 	}
 	spill_col_idx += payload.ColumnCount();
 	spill_chunk.data[spill_col_idx].Reference(hashes);
+	spill_chunk.SetCardinality(keys.size());
 }
 
 void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
@@ -1501,7 +1713,11 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
 	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
+	// if the partitions of this round are built in parts, we probe the first part now, but we spill all values so
+	// they can be probed with the next parts
+	if (!split_round) {
+		spill_chunk.Slice(false_sel, false_count);
+	}
 	spill_chunk.Verify();
 	probe_spill.Append(spill_chunk, spill_state);
 
@@ -1561,12 +1777,16 @@ void ProbeSpill::Finalize() {
 
 void ProbeSpill::PrepareNextProbe() {
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
+	if (!ht.IsFirstPart() && global_spill_collection) {
+		// The HT is building the next part of the same partitions, we probe the same data again
+	} else if (partitions.empty() || ht.partition_start == partitions.size()) {
 		// Can't probe, just make an empty one
 		global_spill_collection =
 		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
 	} else {
 		// Move specific partitions to the global spill collection
+		// If the first round is built in parts, we get here for its second part: the first part was probed while
+		// spilling, and the next parts probe the spilled data of these partitions
 		global_spill_collection = std::move(partitions[ht.partition_start]);
 		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
 			auto &partition = partitions[i];
@@ -1577,7 +1797,8 @@ void ProbeSpill::PrepareNextProbe() {
 			}
 		}
 	}
-	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
+	// Only consume the data if it does not have to be probed again for the next part
+	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids, ht.IsLastPart());
 	consumer->InitializeScan();
 }
 
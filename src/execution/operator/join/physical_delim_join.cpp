@@ -1,6 +1,12 @@
 #include "duckdb/execution/operator/join/physical_delim_join.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -23,6 +29,148 @@ vector<const_reference<PhysicalOperator>> PhysicalDelimJoin::GetChildren() const
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// Filter Pushdown
+//===--------------------------------------------------------------------===//
+void PhysicalDelimJoin::SetFilterPushdown(vector<unique_ptr<JoinFilterPushdownInfo>> filter_pushdown_p) {
+	filter_pushdown = std::move(filter_pushdown_p);
+	// we create a bloom filter for every duplicate eliminated column that we push a filter on
+	bloom_filter_columns.clear();
+	for (auto &info : filter_pushdown) {
+		for (auto &filter : info->filters) {
+			auto delim_col_idx = filter.join_condition;
+			if (std::find(bloom_filter_columns.begin(), bloom_filter_columns.end(), delim_col_idx) ==
+			    bloom_filter_columns.end()) {
+				bloom_filter_columns.push_back(delim_col_idx);
+			}
+		}
+	}
+}
+
+unique_ptr<DelimJoinFilterGlobalState> PhysicalDelimJoin::GetFilterGlobalState(ClientContext &context) const {
+	D_ASSERT(!filter_pushdown.empty());
+	auto result = make_uniq<DelimJoinFilterGlobalState>();
+	for (auto &info : filter_pushdown) {
+		result->filter_states.push_back(info->GetGlobalState(context, *this));
+	}
+	result->hashes.resize(bloom_filter_columns.size());
+	return result;
+}
+
+unique_ptr<DelimJoinFilterLocalState> PhysicalDelimJoin::GetFilterLocalState(DelimJoinFilterGlobalState &gstate) const {
+	auto result = make_uniq<DelimJoinFilterLocalState>();
+	vector<LogicalType> delim_types;
+	for (auto &group : distinct->grouped_aggregate_data.groups) {
+		delim_types.push_back(group->return_type);
+	}
+	result->delim_columns.InitializeEmpty(delim_types);
+	for (idx_t info_idx = 0; info_idx < filter_pushdown.size(); info_idx++) {
+		result->filter_states.push_back(filter_pushdown[info_idx]->GetLocalState(*gstate.filter_states[info_idx]));
+	}
+	result->hashes.resize(bloom_filter_columns.size());
+	return result;
+}
+
+void PhysicalDelimJoin::SinkFilters(DataChunk &chunk, DelimJoinFilterGlobalState &gstate,
+                                    DelimJoinFilterLocalState &lstate) const {
+	// reference the duplicate eliminated columns
+	auto &groups = distinct->grouped_aggregate_data.groups;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &bound_ref = groups[group_idx]->Cast<BoundReferenceExpression>();
+		lstate.delim_columns.data[group_idx].Reference(chunk.data[bound_ref.index]);
+	}
+	lstate.delim_columns.SetCardinality(chunk);
+
+	// compute the min/max
+	for (idx_t info_idx = 0; info_idx < filter_pushdown.size(); info_idx++) {
+		filter_pushdown[info_idx]->Sink(lstate.delim_columns, *lstate.filter_states[info_idx]);
+	}
+
+	// collect the hashes for the bloom filters (unless we have already collected too many)
+	const auto count = chunk.size();
+	if (gstate.hash_count.fetch_add(count) + count > MAXIMUM_BLOOM_FILTER_COUNT) {
+		return;
+	}
+	for (idx_t bloom_idx = 0; bloom_idx < bloom_filter_columns.size(); bloom_idx++) {
+		auto &delim_column = lstate.delim_columns.data[bloom_filter_columns[bloom_idx]];
+		VectorOperations::Hash(delim_column, lstate.hash_vector, count);
+		lstate.hash_vector.Flatten(count);
+		auto hash_data = FlatVector::GetData<hash_t>(lstate.hash_vector);
+		auto &hashes = lstate.hashes[bloom_idx];
+		hashes.insert(hashes.end(), hash_data, hash_data + count);
+	}
+}
+
+void PhysicalDelimJoin::CombineFilters(DelimJoinFilterGlobalState &gstate, DelimJoinFilterLocalState &lstate) const {
+	for (idx_t info_idx = 0; info_idx < filter_pushdown.size(); info_idx++) {
+		filter_pushdown[info_idx]->Combine(*gstate.filter_states[info_idx], *lstate.filter_states[info_idx]);
+	}
+	if (gstate.hash_count > MAXIMUM_BLOOM_FILTER_COUNT) {
+		// we are not going to create bloom filters
+		return;
+	}
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t bloom_idx = 0; bloom_idx < bloom_filter_columns.size(); bloom_idx++) {
+		auto &hashes = gstate.hashes[bloom_idx];
+		auto &local_hashes = lstate.hashes[bloom_idx];
+		hashes.insert(hashes.end(), local_hashes.begin(), local_hashes.end());
+	}
+}
+
+void PhysicalDelimJoin::PushFilters(DelimJoinFilterGlobalState &gstate) const {
+	// push the min/max filters
+	for (idx_t info_idx = 0; info_idx < filter_pushdown.size(); info_idx++) {
+		filter_pushdown[info_idx]->PushFilters(*gstate.filter_states[info_idx], *this);
+	}
+	if (gstate.hash_count > MAXIMUM_BLOOM_FILTER_COUNT) {
+		return;
+	}
+	// create and push the bloom filters
+	for (idx_t bloom_idx = 0; bloom_idx < bloom_filter_columns.size(); bloom_idx++) {
+		auto &hashes = gstate.hashes[bloom_idx];
+		if (BlockedBloomFilter::SizeInBytes(hashes.size()) > BlockedBloomFilter::MAXIMUM_SIZE) {
+			continue;
+		}
+		auto bloom_filter = make_shared_ptr<BlockedBloomFilter>(hashes.size());
+		Vector hash_vector(LogicalType::HASH, data_ptr_cast(hashes.data()));
+		bloom_filter->Insert(hash_vector, hashes.size(), false);
+
+		auto delim_col_idx = bloom_filter_columns[bloom_idx];
+		for (auto &info : filter_pushdown) {
+			for (auto &filter : info->filters) {
+				if (filter.join_condition == delim_col_idx) {
+					auto filter_col_idx = filter.probe_column_index.column_index;
+					info->dynamic_filters->PushFilter(*this, filter_col_idx, make_uniq<BloomFilter>(bloom_filter));
+				}
+			}
+		}
+	}
+}
+
+void PhysicalDelimJoin::AddFilterDependencies(MetaPipeline &meta_pipeline, Pipeline &delim_pipeline) const {
+	if (filter_pushdown.empty()) {
+		return;
+	}
+	// the filters are pushed when the duplicate eliminated side is finalized
+	// scans that we push filters into can only benefit from them if they start afterwards
+	auto delim_dependency = delim_pipeline.shared_from_this();
+	vector<shared_ptr<Pipeline>> pipelines;
+	meta_pipeline.GetPipelines(pipelines, true);
+	for (auto &pipeline : pipelines) {
+		auto source = pipeline->GetSource();
+		if (!source || source->type != PhysicalOperatorType::TABLE_SCAN) {
+			continue;
+		}
+		auto &scan = source->Cast<PhysicalTableScan>();
+		for (auto &info : filter_pushdown) {
+			if (scan.dynamic_filters && scan.dynamic_filters == info->dynamic_filters) {
+				pipeline->AddDependency(delim_dependency);
+				break;
+			}
+		}
+	}
+}
+
 InsertionOrderPreservingMap<string> PhysicalDelimJoin::ParamsToString() const {
 	auto result = join->ParamsToString();
 	result["Delim Index"] = StringUtil::Format("%llu", delim_idx.GetIndex());
@@ -14,6 +14,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -80,6 +81,12 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 		}
 		rhs_output_types.push_back(rhs_col_type);
 	}
+
+	// If the build and probe side swap roles, the LHS columns follow the keys in the layout of the HT
+	auto &lhs_types = children[0]->GetTypes();
+	for (idx_t col_idx = 0; col_idx < lhs_types.size(); col_idx++) {
+		lhs_output_columns.push_back(condition_types.size() + col_idx);
+	}
 }
 
 PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
@@ -115,7 +122,8 @@ public:
 	    : context(context_p), op(op_p),
 	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
+	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), reversible(false),
+	      scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
 
 		// For perfect hash join
@@ -166,6 +174,12 @@ public:
 	vector<LogicalType> probe_types;
 	unique_ptr<JoinHashTable::ProbeSpill> probe_spill;
 
+	//! Whether the build and probe side may swap roles in the rounds of the external join
+	bool reversible;
+	//! HT built on the probe side in the current reversed round, and the thread-local HTs used to build it
+	unique_ptr<JoinHashTable> reversed_hash_table;
+	vector<unique_ptr<JoinHashTable>> reversed_local_hash_tables;
+
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
 
@@ -267,6 +281,25 @@ unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &c
 	return result;
 }
 
+bool PhysicalHashJoin::CanReverseBuildAndProbe() const {
+	if (join_type != JoinType::INNER) {
+		return false;
+	}
+	for (auto &cond : conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeReversedHashTable(ClientContext &context) const {
+	// Equality conditions are symmetric, so we can use them as-is with the probe-side keys as the build keys
+	// NOTE: the HT keeps a reference to the output columns, so these must outlive it
+	return make_uniq<JoinHashTable>(context, conditions, children[0]->GetTypes(), JoinType::INNER, lhs_output_columns);
+}
+
 unique_ptr<GlobalSinkState> PhysicalHashJoin::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<HashJoinGlobalSinkState>(*this, context);
 }
@@ -327,6 +360,7 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 
 	lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 	auto guard = gstate.Lock();
+	gstate.hash_table->heavy_hitters.Combine(lstate.hash_table->heavy_hitters);
 	gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	if (gstate.local_hash_tables.size() == gstate.active_local_states) {
 		// Set to 0 until PrepareFinalize
@@ -386,13 +420,14 @@ void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &
 class HashJoinFinalizeTask : public ExecutorTask {
 public:
 	HashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context, HashJoinGlobalSinkState &sink_p,
-	                     idx_t chunk_idx_from_p, idx_t chunk_idx_to_p, bool parallel_p, const PhysicalOperator &op_p)
+	                     idx_t chunk_idx_from_p, idx_t chunk_idx_to_p, bool parallel_p, bool partitioned_p,
+	                     const PhysicalOperator &op_p)
 	    : ExecutorTask(context, std::move(event_p), op_p), sink(sink_p), chunk_idx_from(chunk_idx_from_p),
-	      chunk_idx_to(chunk_idx_to_p), parallel(parallel_p) {
+	      chunk_idx_to(chunk_idx_to_p), parallel(parallel_p), partitioned(partitioned_p) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
-		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel);
+		sink.hash_table->Finalize(chunk_idx_from, chunk_idx_to, parallel, partitioned);
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
@@ -402,6 +437,7 @@ private:
 	idx_t chunk_idx_from;
 	idx_t chunk_idx_to;
 	bool parallel;
+	bool partitioned;
 };
 
 class HashJoinFinalizeEvent : public BasePipelineEvent {
@@ -418,22 +454,44 @@ public:
 
 		vector<shared_ptr<Task>> finalize_tasks;
 		auto &ht = *sink.hash_table;
-		const auto chunk_count = ht.GetDataCollection().ChunkCount();
+		// If the HT is built in multiple parts, we only build the first part
+		idx_t chunk_idx_start;
+		idx_t chunk_count;
+		ht.GetBuildChunkRange(chunk_idx_start, chunk_count);
 		const auto num_threads = NumericCast<idx_t>(sink.num_threads);
 		if (num_threads == 1 || (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
 			// Single-threaded finalize
-			finalize_tasks.push_back(
-			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, chunk_count, false, sink.op));
+			finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+			                                                         chunk_idx_start, chunk_count, false, false,
+			                                                         sink.op));
+		} else if (ht.GetRegionCount() >= num_threads) {
+			// Partitioned finalize: every task builds whole regions of the pointer table without synchronization
+			const auto region_count = ht.GetRegionCount();
+			const auto regions_per_thread = (region_count + num_threads - 1) / num_threads;
+			for (idx_t region_idx = 0; region_idx < region_count; region_idx += regions_per_thread) {
+				const auto region_idx_to = MinValue<idx_t>(region_idx + regions_per_thread, region_count);
+				idx_t chunk_idx_from;
+				idx_t chunk_idx_to;
+				ht.GetRegionChunkRange(region_idx, region_idx_to, chunk_idx_from, chunk_idx_to);
+				if (chunk_idx_from == chunk_idx_to) {
+					continue;
+				}
+				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+				                                                         chunk_idx_from, chunk_idx_to, true, true,
+				                                                         sink.op));
+			}
 		} else {
 			// Parallel finalize
-			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+			auto chunks_per_thread =
+			    MaxValue<idx_t>((chunk_count - chunk_idx_start + num_threads - 1) / num_threads, 1);
 
-			idx_t chunk_idx = 0;
+			idx_t chunk_idx = chunk_idx_start;
 			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
 				auto chunk_idx_from = chunk_idx;
 				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
 				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
-				                                                         chunk_idx_from, chunk_idx_to, true, sink.op));
+				                                                         chunk_idx_from, chunk_idx_to, true, false,
+				                                                         sink.op));
 				chunk_idx = chunk_idx_to;
 				if (chunk_idx == chunk_count) {
 					break;
@@ -444,8 +502,14 @@ public:
 	}
 
 	void FinishEvent() override {
-		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+		if (!sink.hash_table->IsSplitRound()) {
+			sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+		}
 		sink.hash_table->finalized = true;
+		if (sink.hash_table->bloom_filter) {
+			// the bloom filter was filled while building the pointer table - push it into the probe side
+			sink.op.filter_pushdown->PushBloomFilter(std::move(sink.hash_table->bloom_filter), sink.op);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -603,6 +667,27 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	}
 }
 
+shared_ptr<BlockedBloomFilter> JoinFilterPushdownInfo::CreateBloomFilter(idx_t condition_count,
+                                                                          idx_t build_count) const {
+	if (filters.size() != 1 || condition_count != 1) {
+		// the hashes in the hash table are computed over all join keys
+		// we can only re-use them for a bloom filter if there is a single join key
+		return nullptr;
+	}
+	if (BlockedBloomFilter::SizeInBytes(build_count) > BlockedBloomFilter::MAXIMUM_SIZE) {
+		// build side is too large for the bloom filter
+		return nullptr;
+	}
+	return make_shared_ptr<BlockedBloomFilter>(build_count);
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(shared_ptr<BlockedBloomFilter> bloom_filter,
+                                             const PhysicalOperator &op) const {
+	D_ASSERT(filters.size() == 1);
+	auto filter_col_idx = filters[0].probe_column_index.column_index;
+	dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(std::move(bloom_filter)));
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
@@ -613,6 +698,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	if (sink.external) {
 		// External Hash Join
 		sink.perfect_join_executor.reset();
+		sink.reversible = CanReverseBuildAndProbe();
 
 		const auto max_partition_ht_size =
 		    sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count);
@@ -659,6 +745,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (filter_pushdown && ht.Count() > 0) {
+			// fill a bloom filter with the key hashes while building the pointer table
+			ht.bloom_filter = filter_pushdown->CreateBloomFilter(conditions.size(), ht.Count());
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -771,7 +861,16 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-enum class HashJoinSourceStage : uint8_t { INIT, BUILD, PROBE, SCAN_HT, DONE };
+enum class HashJoinSourceStage : uint8_t {
+	INIT,
+	BUILD,
+	PROBE,
+	SCAN_HT,
+	REVERSED_SINK,
+	REVERSED_BUILD,
+	REVERSED_PROBE,
+	DONE
+};
 
 class HashJoinLocalSourceState;
 
@@ -787,6 +886,10 @@ public:
 	void PrepareBuild(HashJoinGlobalSinkState &sink);
 	void PrepareProbe(HashJoinGlobalSinkState &sink);
 	void PrepareScanHT(HashJoinGlobalSinkState &sink);
+	//! Prepare a round where the build and probe side swap roles, if the probe side is much smaller (must hold lock)
+	bool TryPrepareReversedSink(HashJoinGlobalSinkState &sink);
+	void PrepareReversedBuild(HashJoinGlobalSinkState &sink);
+	void PrepareReversedProbe(HashJoinGlobalSinkState &sink);
 	//! Assigns a task to a local source state
 	bool AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate);
 
@@ -831,6 +934,13 @@ public:
 	atomic<idx_t> full_outer_chunk_done;
 	idx_t full_outer_chunks_per_thread = DConstants::INVALID_INDEX;
 
+	//! For reversed build/probe synchronization (also uses the build/probe chunk counts)
+	idx_t reversed_round = 0;
+	idx_t reversed_probe_chunk_idx = 0;
+
+	//! Only swap the roles of the build and probe side if the build side is this many times larger
+	static constexpr const idx_t REVERSAL_THRESHOLD = 2;
+
 	vector<InterruptState> blocked_tasks;
 };
 
@@ -846,6 +956,9 @@ public:
 	void ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
 	void ExternalProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 	void ExternalScanHT(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
+	//! Sink, probe for the rounds of the external hash join where the build and probe side swap roles
+	void ReversedSink(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
+	void ReversedProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 
 public:
 	//! The stage that this thread was assigned work for
@@ -877,6 +990,17 @@ public:
 	idx_t full_outer_chunk_idx_from = DConstants::INVALID_INDEX;
 	idx_t full_outer_chunk_idx_to = DConstants::INVALID_INDEX;
 	unique_ptr<JoinHTScanState> full_outer_scan_state;
+
+	//! Thread-local HT for building the probe side in a reversed round
+	idx_t reversed_round = DConstants::INVALID_INDEX;
+	optional_ptr<JoinHashTable> reversed_local_hash_table;
+	PartitionedTupleDataAppendState reversed_append_state;
+	//! Chunk of the build side that is assigned to this thread for probing the reversed HT, and its scan state
+	idx_t reversed_probe_chunk_idx = DConstants::INVALID_INDEX;
+	unique_ptr<JoinHTScanState> reversed_probe_scan_state;
+	DataChunk reversed_probe_chunk;
+	DataChunk reversed_result;
+	unique_ptr<JoinHashTable::ScanStructure> reversed_scan_structure;
 };
 
 unique_ptr<GlobalSourceState> PhysicalHashJoin::GetGlobalSourceState(ClientContext &context) const {
@@ -915,7 +1039,9 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 	switch (global_stage.load()) {
 	case HashJoinSourceStage::BUILD:
 		if (build_chunk_done == build_chunk_count) {
-			sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+			if (!sink.hash_table->IsSplitRound()) {
+				sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+			}
 			sink.hash_table->finalized = true;
 			PrepareProbe(sink);
 			return true;
@@ -937,6 +1063,29 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::REVERSED_SINK:
+		if (probe_chunk_done == probe_chunk_count) {
+			PrepareReversedBuild(sink);
+			return true;
+		}
+		break;
+	case HashJoinSourceStage::REVERSED_BUILD:
+		if (build_chunk_done == build_chunk_count) {
+			sink.reversed_hash_table->GetDataCollection().VerifyEverythingPinned();
+			sink.reversed_hash_table->finalized = true;
+			PrepareReversedProbe(sink);
+			return true;
+		}
+		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		if (probe_chunk_done == probe_chunk_count) {
+			// This round is done, we no longer need its data
+			sink.reversed_hash_table.reset();
+			sink.hash_table->Reset();
+			PrepareBuild(sink);
+			return true;
+		}
+		break;
 	default:
 		break;
 	}
@@ -950,6 +1099,10 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	// Update remaining size
 	sink.temporary_memory_state->SetRemainingSizeAndUpdateReservation(sink.context, ht.GetRemainingSize());
 
+	if (sink.external && TryPrepareReversedSink(sink)) {
+		return;
+	}
+
 	// Try to put the next partitions in the block collection of the HT
 	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
 		global_stage = HashJoinSourceStage::DONE;
@@ -963,11 +1116,12 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 		return;
 	}
 
-	build_chunk_idx = 0;
-	build_chunk_count = data_collection.ChunkCount();
-	build_chunk_done = 0;
+	// If the partitions are built in multiple parts, this is the range of chunks of the current part
+	ht.GetBuildChunkRange(build_chunk_idx, build_chunk_count);
+	build_chunk_done = build_chunk_idx;
 
-	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + sink.num_threads - 1) / sink.num_threads, 1);
+	build_chunks_per_thread =
+	    MaxValue<idx_t>((build_chunk_count - build_chunk_idx + sink.num_threads - 1) / sink.num_threads, 1);
 
 	ht.InitializePointerTable();
 
@@ -1003,6 +1157,97 @@ void HashJoinGlobalSourceState::PrepareScanHT(HashJoinGlobalSinkState &sink) {
 	global_stage = HashJoinSourceStage::SCAN_HT;
 }
 
+bool HashJoinGlobalSourceState::TryPrepareReversedSink(HashJoinGlobalSinkState &sink) {
+	auto &ht = *sink.hash_table;
+	if (!sink.reversible || !sink.probe_spill || !ht.IsLastPart()) {
+		return false;
+	}
+
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(ht.GetRadixBits());
+	auto &build_partitions = ht.GetSinkCollection().GetPartitions();
+	auto &probe_partitions = sink.probe_spill->GetPartitions();
+	if (ht.GetPartitionEnd() == num_partitions || probe_partitions.size() != num_partitions) {
+		return false;
+	}
+
+	// Determine how many partitions fit if we build the probe side instead (at least one)
+	const auto max_ht_size = sink.temporary_memory_state->GetReservation();
+	idx_t build_size = 0;
+	idx_t probe_count = 0;
+	idx_t probe_size = 0;
+	idx_t partition_idx;
+	for (partition_idx = ht.GetPartitionEnd(); partition_idx < num_partitions; partition_idx++) {
+		auto incl_count = probe_count + probe_partitions[partition_idx]->Count();
+		auto incl_size = probe_size + probe_partitions[partition_idx]->SizeInBytes();
+		if (probe_count > 0 && incl_size + JoinHashTable::PointerTableSize(incl_count) > max_ht_size) {
+			break;
+		}
+		probe_count = incl_count;
+		probe_size = incl_size;
+		build_size += build_partitions[partition_idx]->SizeInBytes();
+	}
+
+	// Only swap roles if the probe side of these partitions is much smaller than the build side
+	const auto reversed_ht_size = probe_size + JoinHashTable::PointerTableSize(probe_count);
+	if (build_size < REVERSAL_THRESHOLD * reversed_ht_size) {
+		return false;
+	}
+
+	// The build side of these partitions is scanned, and the probe side is built
+	ht.PrepareExternalScan(partition_idx);
+	sink.probe_spill->PrepareNextProbe();
+	sink.reversed_hash_table = op.InitializeReversedHashTable(sink.context);
+	sink.reversed_local_hash_tables.clear();
+	reversed_round++;
+
+	const auto &consumer = *sink.probe_spill->consumer;
+	probe_chunk_count = consumer.Count() == 0 ? 0 : consumer.ChunkCount();
+	probe_chunk_done = 0;
+
+	global_stage = HashJoinSourceStage::REVERSED_SINK;
+	if (probe_chunk_count == 0) {
+		TryPrepareNextStage(sink);
+	}
+	return true;
+}
+
+void HashJoinGlobalSourceState::PrepareReversedBuild(HashJoinGlobalSinkState &sink) {
+	auto &reversed_ht = *sink.reversed_hash_table;
+	for (auto &local_ht : sink.reversed_local_hash_tables) {
+		reversed_ht.Merge(*local_ht);
+	}
+	sink.reversed_local_hash_tables.clear();
+	reversed_ht.Unpartition();
+
+	build_chunk_idx = 0;
+	build_chunk_count = reversed_ht.GetDataCollection().ChunkCount();
+	build_chunk_done = 0;
+	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + sink.num_threads - 1) / sink.num_threads, 1);
+
+	global_stage = HashJoinSourceStage::REVERSED_BUILD;
+	if (reversed_ht.Count() == 0) {
+		// Nothing to build, and nothing can match: the inner join has no results for these partitions
+		build_chunk_count = 0;
+		TryPrepareNextStage(sink);
+		return;
+	}
+	reversed_ht.InitializePointerTable();
+}
+
+void HashJoinGlobalSourceState::PrepareReversedProbe(HashJoinGlobalSinkState &sink) {
+	auto &reversed_ht = *sink.reversed_hash_table;
+	auto &data_collection = sink.hash_table->GetDataCollection();
+
+	reversed_probe_chunk_idx = 0;
+	probe_chunk_count = reversed_ht.Count() == 0 ? 0 : data_collection.ChunkCount();
+	probe_chunk_done = 0;
+
+	global_stage = HashJoinSourceStage::REVERSED_PROBE;
+	if (probe_chunk_count == 0) {
+		TryPrepareNextStage(sink);
+	}
+}
+
 bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate) {
 	D_ASSERT(lstate.TaskFinished());
 
@@ -1034,6 +1279,41 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::REVERSED_SINK:
+		if (sink.probe_spill->consumer->AssignChunk(lstate.probe_local_scan)) {
+			lstate.local_stage = global_stage;
+			if (lstate.reversed_round != reversed_round) {
+				// First chunk of this round for this thread: create a thread-local HT
+				sink.reversed_local_hash_tables.push_back(op.InitializeReversedHashTable(sink.context));
+				lstate.reversed_local_hash_table = sink.reversed_local_hash_tables.back().get();
+				lstate.reversed_local_hash_table->GetSinkCollection().InitializeAppendState(
+				    lstate.reversed_append_state);
+				lstate.reversed_round = reversed_round;
+			}
+			return true;
+		}
+		break;
+	case HashJoinSourceStage::REVERSED_BUILD:
+		if (build_chunk_idx != build_chunk_count) {
+			lstate.local_stage = global_stage;
+			lstate.build_chunk_idx_from = build_chunk_idx;
+			build_chunk_idx = MinValue<idx_t>(build_chunk_count, build_chunk_idx + build_chunks_per_thread);
+			lstate.build_chunk_idx_to = build_chunk_idx;
+			return true;
+		}
+		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		if (reversed_probe_chunk_idx != probe_chunk_count) {
+			lstate.local_stage = global_stage;
+			lstate.reversed_probe_chunk_idx = reversed_probe_chunk_idx++;
+			if (!lstate.reversed_scan_structure ||
+			    &lstate.reversed_scan_structure->ht != sink.reversed_hash_table.get()) {
+				lstate.reversed_scan_structure =
+				    make_uniq<JoinHashTable::ScanStructure>(*sink.reversed_hash_table, lstate.join_key_state);
+			}
+			return true;
+		}
+		break;
 	case HashJoinSourceStage::DONE:
 		break;
 	default:
@@ -1062,6 +1342,17 @@ HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, c
 	for (; col_idx < sink.probe_types.size() - 1; col_idx++) {
 		payload_indices.push_back(col_idx);
 	}
+
+	if (sink.reversible) {
+		// The build side (keys and payload) is the probe of the reversed HT, which outputs it followed by the LHS
+		vector<LogicalType> reversed_probe_types(op.condition_types);
+		reversed_probe_types.insert(reversed_probe_types.end(), op.payload_types.begin(), op.payload_types.end());
+		reversed_probe_chunk.Initialize(allocator, reversed_probe_types);
+		auto reversed_result_types = reversed_probe_types;
+		auto &lhs_types = op.children[0]->GetTypes();
+		reversed_result_types.insert(reversed_result_types.end(), lhs_types.begin(), lhs_types.end());
+		reversed_result.Initialize(allocator, reversed_result_types);
+	}
 }
 
 void HashJoinLocalSourceState::ExecuteTask(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
@@ -1076,6 +1367,15 @@ void HashJoinLocalSourceState::ExecuteTask(HashJoinGlobalSinkState &sink, HashJo
 	case HashJoinSourceStage::SCAN_HT:
 		ExternalScanHT(sink, gstate, chunk);
 		break;
+	case HashJoinSourceStage::REVERSED_SINK:
+		ReversedSink(sink, gstate);
+		break;
+	case HashJoinSourceStage::REVERSED_BUILD:
+		ExternalBuild(sink, gstate);
+		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		ReversedProbe(sink, gstate, chunk);
+		break;
 	default:
 		throw InternalException("Unexpected HashJoinSourceStage in ExecuteTask!");
 	}
@@ -1085,20 +1385,24 @@ bool HashJoinLocalSourceState::TaskFinished() const {
 	switch (local_stage) {
 	case HashJoinSourceStage::INIT:
 	case HashJoinSourceStage::BUILD:
+	case HashJoinSourceStage::REVERSED_SINK:
+	case HashJoinSourceStage::REVERSED_BUILD:
 		return true;
 	case HashJoinSourceStage::PROBE:
 		return scan_structure.is_null && !empty_ht_probe_in_progress;
 	case HashJoinSourceStage::SCAN_HT:
 		return full_outer_scan_state == nullptr;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		return reversed_scan_structure->is_null;
 	default:
 		throw InternalException("Unexpected HashJoinSourceStage in TaskFinished!");
 	}
 }
 
 void HashJoinLocalSourceState::ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate) {
-	D_ASSERT(local_stage == HashJoinSourceStage::BUILD);
+	D_ASSERT(local_stage == HashJoinSourceStage::BUILD || local_stage == HashJoinSourceStage::REVERSED_BUILD);
 
-	auto &ht = *sink.hash_table;
+	auto &ht = local_stage == HashJoinSourceStage::BUILD ? *sink.hash_table : *sink.reversed_hash_table;
 	ht.Finalize(build_chunk_idx_from, build_chunk_idx_to, true);
 
 	auto guard = gstate.Lock();
@@ -1163,6 +1467,76 @@ void HashJoinLocalSourceState::ExternalScanHT(HashJoinGlobalSinkState &sink, Has
 	}
 }
 
+void HashJoinLocalSourceState::ReversedSink(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate) {
+	D_ASSERT(local_stage == HashJoinSourceStage::REVERSED_SINK);
+
+	// Scan the spilled probe-side chunk, and build it into the thread-local HT
+	sink.probe_spill->consumer->ScanChunk(probe_local_scan, probe_chunk);
+	join_keys.ReferenceColumns(probe_chunk, join_key_indices);
+	payload.ReferenceColumns(probe_chunk, payload_indices);
+
+	auto &local_ht = *reversed_local_hash_table;
+	local_ht.Build(reversed_append_state, join_keys, payload);
+	// Flush right away, we do not know whether this thread gets another chunk of this round
+	local_ht.GetSinkCollection().FlushAppendState(reversed_append_state);
+	sink.probe_spill->consumer->FinishChunk(probe_local_scan);
+
+	auto guard = gstate.Lock();
+	gstate.probe_chunk_done++;
+}
+
+void HashJoinLocalSourceState::ReversedProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
+                                             DataChunk &chunk) {
+	D_ASSERT(local_stage == HashJoinSourceStage::REVERSED_PROBE && sink.reversed_hash_table->finalized);
+	auto &reversed_scan = *reversed_scan_structure;
+
+	if (!reversed_scan.is_null) {
+		// Still have elements remaining (i.e. we got >STANDARD_VECTOR_SIZE elements in the previous probe)
+		reversed_result.Reset();
+		reversed_scan.Next(join_keys, reversed_probe_chunk, reversed_result);
+		if (reversed_result.size() == 0 && reversed_scan.PointersExhausted()) {
+			// Previous probe is done
+			reversed_scan.is_null = true;
+			reversed_probe_scan_state = nullptr;
+			auto guard = gstate.Lock();
+			gstate.probe_chunk_done++;
+			return;
+		}
+	} else {
+		// Gather the keys and payload of the assigned build-side chunk (these stay pinned until we are done with it)
+		auto &data_collection = sink.hash_table->GetDataCollection();
+		reversed_probe_scan_state =
+		    make_uniq<JoinHTScanState>(data_collection, reversed_probe_chunk_idx, reversed_probe_chunk_idx + 1,
+		                               TupleDataPinProperties::UNPIN_AFTER_DONE);
+		auto &iterator = reversed_probe_scan_state->iterator;
+		const auto count = iterator.GetCurrentChunkCount();
+		reversed_probe_chunk.Reset();
+		for (idx_t col_idx = 0; col_idx < reversed_probe_chunk.ColumnCount(); col_idx++) {
+			data_collection.Gather(iterator.GetChunkState().row_locations, *FlatVector::IncrementalSelectionVector(),
+			                       count, col_idx, reversed_probe_chunk.data[col_idx],
+			                       *FlatVector::IncrementalSelectionVector(), nullptr);
+		}
+		reversed_probe_chunk.SetCardinality(count);
+
+		// Probe the HT that was built on the probe side with it
+		join_keys.ReferenceColumns(reversed_probe_chunk, join_key_indices);
+		sink.reversed_hash_table->Probe(reversed_scan, join_keys, join_key_state, probe_state);
+		reversed_result.Reset();
+		reversed_scan.Next(join_keys, reversed_probe_chunk, reversed_result);
+	}
+
+	// The reversed HT outputs the build side followed by the LHS, but we need to output the LHS followed by the RHS
+	const auto build_column_count = reversed_probe_chunk.ColumnCount();
+	const auto lhs_column_count = reversed_result.ColumnCount() - build_column_count;
+	for (idx_t col_idx = 0; col_idx < lhs_column_count; col_idx++) {
+		chunk.data[col_idx].Reference(reversed_result.data[build_column_count + col_idx]);
+	}
+	for (idx_t i = 0; i < gstate.op.rhs_output_columns.size(); i++) {
+		chunk.data[lhs_column_count + i].Reference(reversed_result.data[gstate.op.rhs_output_columns[i]]);
+	}
+	chunk.SetCardinality(reversed_result.size());
+}
+
 SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSourceInput &input) const {
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
@@ -0,0 +1,248 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> outer,
+                                     unique_ptr<Expression> outer_key_p, DuckTableEntry &table, ART &index,
+                                     vector<column_t> fetch_ids_p, vector<LogicalType> fetch_types_p,
+                                     vector<idx_t> outer_projection_p, vector<idx_t> inner_projection_p,
+                                     bool inner_is_left, idx_t estimated_cardinality)
+    : CachingPhysicalOperator(PhysicalOperatorType::INDEX_JOIN, std::move(types), estimated_cardinality),
+      outer_key(std::move(outer_key_p)), table(table), index(index), fetch_ids(std::move(fetch_ids_p)),
+      fetch_types(std::move(fetch_types_p)), outer_projection(std::move(outer_projection_p)),
+      inner_projection(std::move(inner_projection_p)), inner_is_left(inner_is_left) {
+	D_ASSERT(!fetch_ids.empty() && fetch_ids.back() == COLUMN_IDENTIFIER_ROW_ID);
+	children.push_back(std::move(outer));
+}
+
+class IndexJoinGlobalState : public GlobalOperatorState {
+public:
+	//! The index on the join key of the rows that the transaction appended to the table (if any)
+	optional_ptr<ART> local_index;
+	//! The index over the appended rows, if the local storage does not maintain one for the index
+	unique_ptr<ART> owned_local_index;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalIndexJoin::GetGlobalOperatorState(ClientContext &context) const {
+	auto result = make_uniq<IndexJoinGlobalState>();
+	auto &storage = table.GetStorage();
+	auto &local_storage = LocalStorage::Get(context, table.catalog);
+	if (local_storage.AddedRows(storage) == 0) {
+		return std::move(result);
+	}
+
+	// the appended rows are added to the index of the table when the transaction commits
+	// until then, we look up the join keys in an index over the transaction-local rows
+	if (index.GetConstraintType() != IndexConstraintType::NONE) {
+		// the local storage maintains an index over the appended rows for every unique index
+		local_storage.GetIndexes(storage).ScanBound<ART>([&](ART &local_index) {
+			if (local_index.GetIndexName() != index.GetIndexName()) {
+				return false;
+			}
+			result->local_index = local_index;
+			return true;
+		});
+		if (result->local_index) {
+			return std::move(result);
+		}
+	}
+
+	// otherwise, we build an index over the appended rows
+	// the planner only plans index joins if the transaction appended few rows to the table
+	vector<unique_ptr<Expression>> unbound_expressions;
+	for (auto &expr : index.unbound_expressions) {
+		unbound_expressions.push_back(expr->Copy());
+	}
+	result->owned_local_index = make_uniq<ART>(index.GetIndexName(), IndexConstraintType::NONE, index.GetColumnIds(),
+	                                           index.table_io_manager, unbound_expressions, index.db);
+	result->local_index = *result->owned_local_index;
+
+	vector<storage_t> column_ids {index.GetColumnIds()[0], COLUMN_IDENTIFIER_ROW_ID};
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	local_storage.InitializeScan(storage, scan_state.local_state, nullptr);
+
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::Get(context), vector<LogicalType> {index.logical_types[0], LogicalType::ROW_TYPE});
+	DataChunk keys;
+	keys.InitializeEmpty(vector<LogicalType> {index.logical_types[0]});
+	IndexLock lock;
+	result->local_index->InitializeLock(lock);
+	while (true) {
+		scan_chunk.Reset();
+		local_storage.Scan(scan_state.local_state, column_ids, scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		keys.data[0].Reference(scan_chunk.data[0]);
+		keys.SetCardinality(scan_chunk);
+		auto error = result->local_index->Insert(lock, keys, scan_chunk.data[1]);
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+	return std::move(result);
+}
+
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : probe_executor(context, *op.outer_key), keys_fetched(false), fetching_local(false), outer_idx(0),
+	      match_idx(0), row_ids(LogicalType::ROW_TYPE), outer_sel(STANDARD_VECTOR_SIZE), result_sel(STANDARD_VECTOR_SIZE) {
+		auto &allocator = Allocator::Get(context);
+		join_keys.Initialize(allocator, vector<LogicalType> {op.outer_key->return_type});
+		fetch_chunk.Initialize(allocator, op.fetch_types);
+	}
+
+	//! The executor of the join key of the outer side
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	//! Whether the matching row ids of the current input chunk were looked up
+	bool keys_fetched;
+	//! The matching row ids of each row of the current input chunk
+	vector<unsafe_vector<row_t>> matches;
+	//! The matching row ids of each row of the current input chunk in the transaction-local rows
+	vector<unsafe_vector<row_t>> local_matches;
+	//! Whether we are fetching the matches in the transaction-local rows
+	bool fetching_local;
+	//! The position in the matches of the current input chunk
+	idx_t outer_idx;
+	idx_t match_idx;
+
+	//! The row ids that are fetched, and the row of the outer side that each of them belongs to
+	Vector row_ids;
+	SelectionVector outer_sel;
+	SelectionVector result_sel;
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<IndexJoinGlobalState>();
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+
+	if (!state.keys_fetched) {
+		// look up the join keys of the input chunk in the index
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		index.SearchEqual(state.join_keys, state.matches);
+		if (gstate.local_index) {
+			gstate.local_index->SearchEqual(state.join_keys, state.local_matches);
+		}
+		state.keys_fetched = true;
+		state.fetching_local = false;
+		state.outer_idx = 0;
+		state.match_idx = 0;
+	}
+
+	auto row_id_data = FlatVector::GetData<row_t>(state.row_ids);
+	idx_t result_count = 0;
+	while (result_count == 0) {
+		if (state.outer_idx == input.size()) {
+			if (state.fetching_local || !gstate.local_index) {
+				break;
+			}
+			// continue with the matches in the transaction-local rows
+			state.fetching_local = true;
+			state.outer_idx = 0;
+			state.match_idx = 0;
+		}
+
+		// gather the next vector of row ids to fetch
+		auto &matches = state.fetching_local ? state.local_matches : state.matches;
+		idx_t fetch_count = 0;
+		while (state.outer_idx < input.size() && fetch_count < STANDARD_VECTOR_SIZE) {
+			auto &outer_matches = matches[state.outer_idx];
+			auto match_count =
+			    MinValue<idx_t>(outer_matches.size() - state.match_idx, STANDARD_VECTOR_SIZE - fetch_count);
+			for (idx_t i = 0; i < match_count; i++) {
+				row_id_data[fetch_count] = outer_matches[state.match_idx + i];
+				state.outer_sel.set_index(fetch_count, state.outer_idx);
+				fetch_count++;
+			}
+			state.match_idx += match_count;
+			if (state.match_idx == outer_matches.size()) {
+				state.outer_idx++;
+				state.match_idx = 0;
+			}
+		}
+		if (fetch_count == 0) {
+			continue;
+		}
+
+		// fetch the rows, this skips rows that are not visible to the transaction
+		state.fetch_chunk.Reset();
+		if (state.fetching_local) {
+			auto &local_storage = LocalStorage::Get(transaction);
+			local_storage.FetchChunk(storage, state.row_ids, fetch_count, fetch_ids, state.fetch_chunk,
+			                         state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, fetch_ids, state.row_ids, fetch_count, state.fetch_state);
+		}
+
+		// the fetched rows are a subsequence of the requested rows, match them by their row id
+		auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+		idx_t requested_idx = 0;
+		for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+			while (row_id_data[requested_idx] != fetched_row_ids[i]) {
+				requested_idx++;
+				D_ASSERT(requested_idx < fetch_count);
+			}
+			state.result_sel.set_index(i, state.outer_sel.get_index(requested_idx));
+			requested_idx++;
+		}
+		result_count = state.fetch_chunk.size();
+	}
+
+	if (result_count > 0) {
+		idx_t outer_offset = inner_is_left ? inner_projection.size() : 0;
+		idx_t inner_offset = inner_is_left ? 0 : outer_projection.size();
+		for (idx_t i = 0; i < outer_projection.size(); i++) {
+			chunk.data[outer_offset + i].Slice(input.data[outer_projection[i]], state.result_sel, result_count);
+		}
+		for (idx_t i = 0; i < inner_projection.size(); i++) {
+			chunk.data[inner_offset + i].Reference(state.fetch_chunk.data[inner_projection[i]]);
+		}
+	}
+	chunk.SetCardinality(result_count);
+
+	if (state.outer_idx < input.size() || (!state.fetching_local && gstate.local_index)) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.keys_fetched = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+InsertionOrderPreservingMap<string> PhysicalIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Table"] = table.name;
+	result["Index"] = index.GetIndexName();
+	result["Conditions"] =
+	    StringUtil::Format("%s = %s", outer_key->GetName(), index.unbound_expressions[0]->GetName());
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -44,6 +44,8 @@ public:
 
 	ColumnDataCollection lhs_data;
 	mutex lhs_lock;
+	//! Filters on the duplicate eliminated columns (if any)
+	unique_ptr<DelimJoinFilterGlobalState> filter_state;
 
 	void Merge(ColumnDataCollection &input) {
 		lock_guard<mutex> guard(lhs_lock);
@@ -61,6 +63,7 @@ public:
 	unique_ptr<LocalSinkState> distinct_state;
 	ColumnDataCollection lhs_data;
 	ColumnDataAppendState append_state;
+	unique_ptr<DelimJoinFilterLocalState> filter_state;
 
 	void Append(DataChunk &input) {
 		lhs_data.Append(input);
@@ -69,6 +72,9 @@ public:
 
 unique_ptr<GlobalSinkState> PhysicalLeftDelimJoin::GetGlobalSinkState(ClientContext &context) const {
 	auto state = make_uniq<LeftDelimJoinGlobalState>(context, *this);
+	if (!filter_pushdown.empty()) {
+		state->filter_state = GetFilterGlobalState(context);
+	}
 	distinct->sink_state = distinct->GetGlobalSinkState(context);
 	if (delim_scans.size() > 1) {
 		PhysicalHashAggregate::SetMultiScan(*distinct->sink_state);
@@ -79,6 +85,10 @@ unique_ptr<GlobalSinkState> PhysicalLeftDelimJoin::GetGlobalSinkState(ClientCont
 unique_ptr<LocalSinkState> PhysicalLeftDelimJoin::GetLocalSinkState(ExecutionContext &context) const {
 	auto state = make_uniq<LeftDelimJoinLocalState>(context.client, *this);
 	state->distinct_state = distinct->GetLocalSinkState(context);
+	auto &gstate = sink_state->Cast<LeftDelimJoinGlobalState>();
+	if (gstate.filter_state) {
+		state->filter_state = GetFilterLocalState(*gstate.filter_state);
+	}
 	return std::move(state);
 }
 
@@ -86,6 +96,10 @@ SinkResultType PhysicalLeftDelimJoin::Sink(ExecutionContext &context, DataChunk
                                            OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
 	lstate.lhs_data.Append(lstate.append_state, chunk);
+	if (lstate.filter_state) {
+		auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
+		SinkFilters(chunk, *gstate.filter_state, *lstate.filter_state);
+	}
 	OperatorSinkInput distinct_sink_input {*distinct->sink_state, *lstate.distinct_state, input.interrupt_state};
 	distinct->Sink(context, chunk, distinct_sink_input);
 	return SinkResultType::NEED_MORE_INPUT;
@@ -95,6 +109,9 @@ SinkCombineResultType PhysicalLeftDelimJoin::Combine(ExecutionContext &context,
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
 	auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
 	gstate.Merge(lstate.lhs_data);
+	if (lstate.filter_state) {
+		CombineFilters(*gstate.filter_state, *lstate.filter_state);
+	}
 
 	OperatorSinkCombineInput distinct_combine_input {*distinct->sink_state, *lstate.distinct_state,
 	                                                 input.interrupt_state};
@@ -114,6 +131,12 @@ SinkFinalizeType PhysicalLeftDelimJoin::Finalize(Pipeline &pipeline, Event &even
 
 	OperatorSinkFinalizeInput finalize_input {*distinct->sink_state, input.interrupt_state};
 	distinct->Finalize(pipeline, event, client, finalize_input);
+
+	// push the filters on the duplicate eliminated columns into the scans on the RHS
+	auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
+	if (gstate.filter_state) {
+		PushFilters(*gstate.filter_state);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -138,6 +161,7 @@ void PhysicalLeftDelimJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta
 		    make_pair(delim_scan, reference<Pipeline>(*child_meta_pipeline.GetBasePipeline())));
 	}
 	join->BuildPipelines(current, meta_pipeline);
+	AddFilterDependencies(meta_pipeline, *child_meta_pipeline.GetBasePipeline());
 }
 
 } // namespace duckdb
@@ -27,16 +27,24 @@ PhysicalRightDelimJoin::PhysicalRightDelimJoin(vector<LogicalType> types, unique
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
-class RightDelimJoinGlobalState : public GlobalSinkState {};
+class RightDelimJoinGlobalState : public GlobalSinkState {
+public:
+	//! Filters on the duplicate eliminated columns (if any)
+	unique_ptr<DelimJoinFilterGlobalState> filter_state;
+};
 
 class RightDelimJoinLocalState : public LocalSinkState {
 public:
 	unique_ptr<LocalSinkState> join_state;
 	unique_ptr<LocalSinkState> distinct_state;
+	unique_ptr<DelimJoinFilterLocalState> filter_state;
 };
 
 unique_ptr<GlobalSinkState> PhysicalRightDelimJoin::GetGlobalSinkState(ClientContext &context) const {
 	auto state = make_uniq<RightDelimJoinGlobalState>();
+	if (!filter_pushdown.empty()) {
+		state->filter_state = GetFilterGlobalState(context);
+	}
 	join->sink_state = join->GetGlobalSinkState(context);
 	distinct->sink_state = distinct->GetGlobalSinkState(context);
 	if (delim_scans.size() > 1) {
@@ -49,6 +57,10 @@ unique_ptr<LocalSinkState> PhysicalRightDelimJoin::GetLocalSinkState(ExecutionCo
 	auto state = make_uniq<RightDelimJoinLocalState>();
 	state->join_state = join->GetLocalSinkState(context);
 	state->distinct_state = distinct->GetLocalSinkState(context);
+	auto &gstate = sink_state->Cast<RightDelimJoinGlobalState>();
+	if (gstate.filter_state) {
+		state->filter_state = GetFilterLocalState(*gstate.filter_state);
+	}
 	return std::move(state);
 }
 
@@ -62,6 +74,11 @@ SinkResultType PhysicalRightDelimJoin::Sink(ExecutionContext &context, DataChunk
 	OperatorSinkInput distinct_sink_input {*distinct->sink_state, *lstate.distinct_state, input.interrupt_state};
 	distinct->Sink(context, chunk, distinct_sink_input);
 
+	if (lstate.filter_state) {
+		auto &gstate = input.global_state.Cast<RightDelimJoinGlobalState>();
+		SinkFilters(chunk, *gstate.filter_state, *lstate.filter_state);
+	}
+
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -76,6 +93,11 @@ SinkCombineResultType PhysicalRightDelimJoin::Combine(ExecutionContext &context,
 	                                                 input.interrupt_state};
 	distinct->Combine(context, distinct_combine_input);
 
+	if (lstate.filter_state) {
+		auto &gstate = input.global_state.Cast<RightDelimJoinGlobalState>();
+		CombineFilters(*gstate.filter_state, *lstate.filter_state);
+	}
+
 	return SinkCombineResultType::FINISHED;
 }
 
@@ -95,6 +117,12 @@ SinkFinalizeType PhysicalRightDelimJoin::Finalize(Pipeline &pipeline, Event &eve
 	OperatorSinkFinalizeInput distinct_finalize_input {*distinct->sink_state, input.interrupt_state};
 	distinct->Finalize(pipeline, event, client, distinct_finalize_input);
 
+	// push the filters on the duplicate eliminated columns into the scans on the LHS
+	auto &gstate = input.global_state.Cast<RightDelimJoinGlobalState>();
+	if (gstate.filter_state) {
+		PushFilters(*gstate.filter_state);
+	}
+
 	return SinkFinalizeType::READY;
 }
 
@@ -121,6 +149,7 @@ void PhysicalRightDelimJoin::BuildPipelines(Pipeline &current, MetaPipeline &met
 
 	// Build join pipelines without building the RHS (already built in the Sink of this op)
 	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *join, false);
+	AddFilterDependencies(meta_pipeline, *child_meta_pipeline.GetBasePipeline());
 }
 
 } // namespace duckdb
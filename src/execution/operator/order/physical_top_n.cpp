@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -75,6 +76,8 @@ public:
 	DataChunk boundary_values;
 	//! Whether or not the boundary_values has been set. The boundary_values are only set after a reduce step
 	bool has_boundary_values;
+	//! The filter that is pushed into the scan (if any) - updated with the boundary of the first ORDER BY column
+	optional_ptr<DynamicFilterData> dynamic_filter;
 
 	SelectionVector final_sel;
 	SelectionVector true_sel;
@@ -326,6 +329,10 @@ void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_c
 		boundary_values.data[i].SetVectorType(VectorType::CONSTANT_VECTOR);
 	}
 	has_boundary_values = true;
+	if (dynamic_filter) {
+		// rows that sort after the boundary can never be part of the result - let the scan skip them
+		dynamic_filter->Update(boundary_values.GetValue(0, 0));
+	}
 }
 
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload) {
@@ -400,9 +407,9 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 
 class TopNGlobalState : public GlobalSinkState {
 public:
-	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
-	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNGlobalState(ClientContext &context, const PhysicalTopN &op)
+	    : heap(context, op.types, op.orders, op.limit, op.offset) {
+		heap.dynamic_filter = op.dynamic_filter.get();
 	}
 
 	mutex lock;
@@ -411,20 +418,24 @@ public:
 
 class TopNLocalState : public LocalSinkState {
 public:
-	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
-	               const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	TopNLocalState(ExecutionContext &context, const PhysicalTopN &op)
+	    : heap(context, op.types, op.orders, op.limit, op.offset) {
+		heap.dynamic_filter = op.dynamic_filter.get();
 	}
 
 	TopNHeap heap;
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) const {
-	return make_uniq<TopNLocalState>(context, types, orders, limit, offset);
+	return make_uniq<TopNLocalState>(context, *this);
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
+	if (dynamic_filter) {
+		// clear the boundary of any previous execution of this operator (e.g. in a recursive CTE)
+		dynamic_filter->Reset();
+	}
+	return make_uniq<TopNGlobalState>(context, *this);
 }
 
 //===--------------------------------------------------------------------===//
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -34,6 +35,13 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	unique_ptr<BoundIndex> global_index;
+
+	//! Lock for the sorted index construction
+	mutex lock;
+	//! The next buffer IDs of the allocators of the global index, the threads reserve their buffer IDs from these
+	unsafe_vector<idx_t> next_buffer_ids;
+	//! The (batch index, tree) pairs of the sorted batches, their nodes are in the allocators of the global index
+	vector<pair<idx_t, Node>> batch_trees;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
@@ -49,6 +57,14 @@ public:
 
 	DataChunk row_id_chunk;
 	unsafe_vector<ARTKey> row_ids;
+
+	//! The batch index of the current batch of sorted data
+	optional_idx current_batch_index;
+	//! The keys and row IDs of the current batch of sorted data
+	unsafe_vector<ARTKey> batch_keys;
+	unsafe_vector<ARTKey> batch_row_ids;
+	//! The (batch index, tree) pairs of the sorted batches, their nodes are in the allocators of the local index
+	vector<pair<idx_t, Node>> batch_trees;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -57,6 +73,7 @@ unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientCon
 	auto &storage = table.GetStorage();
 	state->global_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
 	                                     TableIOManager::Get(storage), unbound_expressions, storage.db);
+	state->next_buffer_ids.resize(ART::ALLOCATOR_COUNT, 0);
 	return (std::move(state));
 }
 
@@ -97,23 +114,41 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(OperatorSinkInput &input) co
 SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
 
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
-	auto &l_index = l_state.local_index;
+	auto row_count = l_state.key_chunk.size();
 
-	// Construct an ART for this chunk.
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
-	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
-	                          l_index->Cast<ART>().allocators);
-	if (!art->Construct(l_state.keys, l_state.row_ids, l_state.key_chunk.size())) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	// Collect the keys of the batch, we construct its ART once the batch is complete.
+	auto &keys = l_state.keys;
+	auto &row_ids = l_state.row_ids;
+	l_state.batch_keys.insert(l_state.batch_keys.end(), keys.begin(), keys.begin() + NumericCast<int64_t>(row_count));
+	l_state.batch_row_ids.insert(l_state.batch_row_ids.end(), row_ids.begin(),
+	                             row_ids.begin() + NumericCast<int64_t>(row_count));
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalCreateARTIndex::ConstructBatch(LocalSinkState &local_state) const {
+
+	auto &l_state = local_state.Cast<CreateARTIndexLocalSinkState>();
+	if (!l_state.current_batch_index.IsValid()) {
+		return;
+	}
+	auto batch_index = l_state.current_batch_index.GetIndex();
+	l_state.current_batch_index = optional_idx();
+	if (l_state.batch_keys.empty()) {
+		return;
 	}
 
-	// Merge the ART into the local ART.
-	if (!l_index->MergeIndexes(*art)) {
+	// The batch is sorted, so we construct its ART bottom-up in the allocators of the local ART.
+	auto &art = l_state.local_index->Cast<ART>();
+	D_ASSERT(!art.tree.HasMetadata());
+	if (!art.Construct(l_state.batch_keys, l_state.batch_row_ids, l_state.batch_keys.size())) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
+	l_state.batch_trees.emplace_back(batch_index, art.tree);
+	art.tree.Clear();
 
-	return SinkResultType::NEED_MORE_INPUT;
+	l_state.batch_keys.clear();
+	l_state.batch_row_ids.clear();
+	l_state.arena_allocator.Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -121,7 +156,12 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 
 	D_ASSERT(chunk.ColumnCount() >= 2);
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	l_state.arena_allocator.Reset();
+	if (sorted) {
+		// The keys of a batch must stay valid until we construct its ART.
+		l_state.current_batch_index = l_state.partition_info.batch_index.GetIndex();
+	} else {
+		l_state.arena_allocator.Reset();
+	}
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
 	ART::GenerateKeyVectors(l_state.arena_allocator, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1],
 	                        l_state.keys, l_state.row_ids);
@@ -132,9 +172,57 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	return SinkUnsorted(input);
 }
 
+SinkNextBatchType PhysicalCreateARTIndex::NextBatch(ExecutionContext &context,
+                                                    OperatorSinkNextBatchInput &input) const {
+	ConstructBatch(input.local_state);
+	return SinkNextBatchType::READY;
+}
+
+SinkCombineResultType PhysicalCreateARTIndex::CombineSorted(OperatorSinkCombineInput &input) const {
+
+	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	ConstructBatch(l_state);
+	if (l_state.batch_trees.empty()) {
+		return SinkCombineResultType::FINISHED;
+	}
+
+	// Reserve the buffer IDs of the local allocators in the global allocators.
+	auto &l_art = l_state.local_index->Cast<ART>();
+	unsafe_vector<idx_t> buffer_id_offsets;
+	{
+		lock_guard<mutex> l(g_state.lock);
+		for (idx_t i = 0; i < ART::ALLOCATOR_COUNT; i++) {
+			buffer_id_offsets.push_back(g_state.next_buffer_ids[i]);
+			g_state.next_buffer_ids[i] += (*l_art.allocators)[i]->GetUpperBoundBufferId();
+		}
+	}
+
+	// Increment the buffer IDs of the local trees without holding the lock.
+	for (auto &batch_tree : l_state.batch_trees) {
+		batch_tree.second.InitMerge(l_art, buffer_id_offsets);
+	}
+
+	// Move the node storage and the trees into the global index.
+	lock_guard<mutex> l(g_state.lock);
+	auto &g_art = g_state.global_index->Cast<ART>();
+	for (idx_t i = 0; i < ART::ALLOCATOR_COUNT; i++) {
+		(*g_art.allocators)[i]->Merge(*(*l_art.allocators)[i], buffer_id_offsets[i]);
+	}
+	for (auto &batch_tree : l_state.batch_trees) {
+		g_state.batch_trees.push_back(batch_tree);
+	}
+	l_state.batch_trees.clear();
+	return SinkCombineResultType::FINISHED;
+}
+
 SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
                                                       OperatorSinkCombineInput &input) const {
 
+	if (sorted) {
+		return CombineSorted(input);
+	}
+
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
@@ -152,6 +240,20 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 
+	if (sorted) {
+		// The key ranges of the batches follow their batch indexes, so each merge only descends along the
+		// rightmost path of the global tree.
+		auto &art = state.global_index->Cast<ART>();
+		std::sort(state.batch_trees.begin(), state.batch_trees.end(),
+		          [](const pair<idx_t, Node> &a, const pair<idx_t, Node> &b) { return a.first < b.first; });
+		for (auto &batch_tree : state.batch_trees) {
+			if (!art.tree.Merge(art, batch_tree.second, art.tree.GetGateStatus())) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+		}
+		state.batch_trees.clear();
+	}
+
 	// vacuum excess memory and verify
 	state.global_index->Vacuum();
 	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
@@ -2,8 +2,10 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -15,6 +17,10 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
@@ -133,6 +139,148 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+//! Returns the ART index of the scanned table on the column referenced by the join key, if the join can look up the
+//! keys of an outer side with the given cardinality in it
+static optional_ptr<ART> GetJoinIndex(ClientContext &context, PhysicalOperator &plan, Expression &key,
+                                      idx_t outer_cardinality) {
+	if (plan.type != PhysicalOperatorType::TABLE_SCAN || key.type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	auto &scan = plan.Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return nullptr;
+	}
+	auto scan_idx = key.Cast<BoundReferenceExpression>().index;
+	auto key_idx = scan.projection_ids.empty() ? scan_idx : scan.projection_ids[scan_idx];
+	if (scan.table_filters) {
+		for (auto &entry : scan.table_filters->filters) {
+			if (entry.first != key_idx) {
+				// the filters on other columns would have to be applied to the fetched rows
+				return nullptr;
+			}
+		}
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	auto &table = bind_data.table;
+	auto &storage = table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context, table.catalog);
+	if (storage.GetDataTableInfo()->IndexesMissVisibleRows(transaction.start_time)) {
+		// rows that were deleted after the transaction started are still visible to it, but no longer in the index
+		return nullptr;
+	}
+
+	// like index scans, only look up a limited number of keys in the index
+	auto &db_config = DBConfig::GetConfig(context);
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage =
+	    LossyNumericCast<idx_t>(double(total_rows) * db_config.options.index_scan_percentage);
+	auto max_lookups = MaxValue(db_config.options.index_scan_max_count, total_rows_from_percentage);
+	if (outer_cardinality > max_lookups) {
+		return nullptr;
+	}
+
+	auto column_id = scan.column_ids[key_idx];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+
+	optional_ptr<ART> result;
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		// NOTE: index joins are only supported for indexes on a single column
+		if (art_index.unbound_expressions.size() != 1 ||
+		    art_index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (art_index.GetColumnIds()[0] != column_id) {
+			return false;
+		}
+		result = &art_index;
+		return true;
+	});
+	if (result && result->GetConstraintType() == IndexConstraintType::NONE) {
+		// the local storage only maintains indexes over the appended rows for unique indexes
+		// for other indexes, the join builds one, so we count the appended rows as lookups
+		auto &local_storage = LocalStorage::Get(context, table.catalog);
+		if (outer_cardinality + local_storage.AddedRows(storage) > max_lookups) {
+			return nullptr;
+		}
+	}
+	return result;
+}
+
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || op.join_type != JoinType::INNER) {
+		return nullptr;
+	}
+	if (op.conditions.size() != 1 || op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	// the indexed table is usually the larger (left) side of the join
+	auto &condition = op.conditions[0];
+	bool inner_is_left = true;
+	auto index = GetJoinIndex(context, *left, *condition.left, right->estimated_cardinality);
+	if (!index) {
+		inner_is_left = false;
+		index = GetJoinIndex(context, *right, *condition.right, left->estimated_cardinality);
+	}
+	if (!index) {
+		return nullptr;
+	}
+	auto &inner = inner_is_left ? left : right;
+	auto &outer = inner_is_left ? right : left;
+	auto &scan = inner->Cast<PhysicalTableScan>();
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+
+	// fetch the columns of the scan, followed by the row ids to match the fetched rows with the outer side
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+	for (auto &column_id : scan.column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			fetch_types.push_back(LogicalType::ROW_TYPE);
+			continue;
+		}
+		auto &column = table.GetColumn(LogicalIndex(column_id));
+		fetch_ids.push_back(column.StorageOid());
+		fetch_types.push_back(column.Type());
+	}
+	fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	fetch_types.push_back(LogicalType::ROW_TYPE);
+
+	vector<idx_t> inner_projection;
+	auto &inner_projection_map = inner_is_left ? op.left_projection_map : op.right_projection_map;
+	auto inner_count = inner_projection_map.empty() ? inner->types.size() : inner_projection_map.size();
+	for (idx_t i = 0; i < inner_count; i++) {
+		auto scan_idx = inner_projection_map.empty() ? i : inner_projection_map[i];
+		inner_projection.push_back(scan.projection_ids.empty() ? scan_idx : scan.projection_ids[scan_idx]);
+	}
+	vector<idx_t> outer_projection = inner_is_left ? op.right_projection_map : op.left_projection_map;
+	if (outer_projection.empty()) {
+		for (idx_t i = 0; i < outer->types.size(); i++) {
+			outer_projection.push_back(i);
+		}
+	}
+	D_ASSERT(op.types.size() == inner_projection.size() + outer_projection.size());
+
+	auto outer_key = inner_is_left ? std::move(condition.right) : std::move(condition.left);
+	if (scan.table_filters && !scan.table_filters->filters.empty()) {
+		// the fetched rows have the keys of the outer side, so we apply the filters on the key column to the outer side
+		vector<unique_ptr<Expression>> filters;
+		for (auto &entry : scan.table_filters->filters) {
+			filters.push_back(entry.second->ToExpression(*outer_key));
+		}
+		auto filter = make_uniq<PhysicalFilter>(outer->types, std::move(filters), outer->estimated_cardinality);
+		filter->children.push_back(std::move(outer));
+		outer = std::move(filter);
+	}
+	return make_uniq<PhysicalIndexJoin>(op.types, std::move(outer), std::move(outer_key), table, *index,
+	                                    std::move(fetch_ids), std::move(fetch_types), std::move(outer_projection),
+	                                    std::move(inner_projection), inner_is_left, op.estimated_cardinality);
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -195,6 +343,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// Equality join of a small outer side with an indexed table: look up the keys in the index
+		plan = PlanIndexJoin(context, op, left, right);
+		if (plan) {
+			return plan;
+		}
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
@@ -59,6 +59,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanDelimJoin(LogicalCompari
 	// we still have to create the DISTINCT clause that is used to generate the duplicate eliminated chunk
 	delim_join->distinct = make_uniq<PhysicalHashAggregate>(context, delim_types, std::move(distinct_expressions),
 	                                                        std::move(distinct_groups), op.estimated_cardinality);
+	// push filters on the duplicate eliminated columns into scans on the delim side (if any)
+	delim_join->SetFilterPushdown(std::move(op.delim_filter_pushdown));
 
 	return std::move(delim_join);
 }
@@ -1,9 +1,171 @@
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
+//! Returns true, if the ART keys of the type are ordered like its values
+static bool SupportsOrderedIndexScan(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	case PhysicalType::VARCHAR:
+		return type.id() == LogicalTypeId::VARCHAR;
+	default:
+		return false;
+	}
+}
+
+//! Returns true, if an ordered index scan can apply the filter on its key column through the bounds of the scan
+//! Sets has_bound, if the filter removes NULL values
+static bool SupportsOrderedIndexScan(const TableFilter &filter, const LogicalType &type, bool &has_bound) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.constant.type() != type) {
+			return false;
+		}
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			has_bound = true;
+			return true;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::IS_NOT_NULL:
+		has_bound = true;
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction.child_filters) {
+			if (!SupportsOrderedIndexScan(*child, type, has_bound)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Turns the table scan below the Top-N into an ordered index scan, if there is an ART index on the first ORDER BY
+//! column of the Top-N, and the scan can read its rows in the order of that index
+static void PlanOrderedIndexScan(ClientContext &context, PhysicalTopN &top_n, PhysicalOperator &plan) {
+	auto &order = top_n.orders[0];
+	if (order.type != OrderType::ASCENDING || order.null_order != OrderByNullType::NULLS_LAST) {
+		// the ART can only be iterated in ascending order, and it does not contain NULL values
+		return;
+	}
+	if (!top_n.dynamic_filter || order.expression->type != ExpressionType::BOUND_REF) {
+		// without the boundary of the heap, the scan would read the entire table in the order of the index
+		return;
+	}
+	if (!SupportsOrderedIndexScan(order.expression->return_type)) {
+		return;
+	}
+
+	// find the table scan that the ORDER BY column originates from
+	auto column_idx = order.expression->Cast<BoundReferenceExpression>().index;
+	reference<PhysicalOperator> child(plan);
+	while (child.get().type == PhysicalOperatorType::PROJECTION) {
+		auto &expr = *child.get().Cast<PhysicalProjection>().select_list[column_idx];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		child = *child.get().children[0];
+	}
+	if (child.get().type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &scan = child.get().Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return;
+	}
+	auto scan_idx = scan.projection_ids.empty() ? column_idx : scan.projection_ids[column_idx];
+	auto column_id = scan.column_ids[scan_idx];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+
+	// the index scan fetches the rows without filtering them, so all filters must be bounds of the index scan
+	bool has_bound = false;
+	if (scan.table_filters) {
+		for (auto &entry : scan.table_filters->filters) {
+			if (entry.first != scan_idx ||
+			    !SupportsOrderedIndexScan(*entry.second, order.expression->return_type, has_bound)) {
+				return;
+			}
+		}
+	}
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	if (!has_bound) {
+		// NULL values are not part of the index - they must be filtered out, or the column must be NOT NULL
+		for (auto &constraint : table.GetConstraints()) {
+			if (constraint->type == ConstraintType::NOT_NULL &&
+			    constraint->Cast<NotNullConstraint>().index == LogicalIndex(column_id)) {
+				has_bound = true;
+			}
+		}
+		if (!has_bound) {
+			return;
+		}
+	}
+
+	// like index scans, only read a limited number of rows through the index
+	auto &storage = table.GetStorage();
+	auto &db_config = DBConfig::GetConfig(context);
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage =
+	    LossyNumericCast<idx_t>(double(total_rows) * db_config.options.index_scan_percentage);
+	if (top_n.limit + top_n.offset > MaxValue(db_config.options.index_scan_max_count, total_rows_from_percentage)) {
+		return;
+	}
+
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		// NOTE: ordered index scans are only supported for indexes on a single column
+		if (art_index.unbound_expressions.size() != 1 ||
+		    art_index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (art_index.GetColumnIds()[0] != column_id) {
+			return false;
+		}
+		scan.function = TableScanFunction::GetOrderedIndexScanFunction();
+		scan.bind_data->Cast<TableScanBindData>().order_index_name = art_index.GetIndexName();
+		return true;
+	});
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -11,6 +173,18 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op)
 
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	if (op.dynamic_filters) {
+		// push a filter on the first ORDER BY column into the scan, its constant is the boundary of the heap
+		auto &order = top_n->orders[0];
+		auto comparison_type = order.type == OrderType::DESCENDING ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                                           : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+		top_n->dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type);
+		op.dynamic_filters->PushFilter(*top_n, op.dynamic_filter_column,
+		                               make_uniq<DynamicFilter>(top_n->dynamic_filter));
+	}
+	// if the ORDER BY column is indexed, read the rows in the order of the index
+	// the heap is filled with the first rows, and its boundary then ends the scan
+	PlanOrderedIndexScan(context, *top_n, *plan);
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
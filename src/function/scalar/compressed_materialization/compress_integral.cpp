@@ -69,22 +69,23 @@ static scalar_function_t GetIntegralCompressFunctionResultSwitch(const LogicalTy
 
 static scalar_function_t GetIntegralCompressFunctionInputSwitch(const LogicalType &input_type,
                                                                 const LogicalType &result_type) {
-	switch (input_type.id()) {
-	case LogicalTypeId::SMALLINT:
+	// temporal types are compressed using their physical (integral) representation
+	switch (input_type.InternalType()) {
+	case PhysicalType::INT16:
 		return GetIntegralCompressFunctionResultSwitch<int16_t>(input_type, result_type);
-	case LogicalTypeId::INTEGER:
+	case PhysicalType::INT32:
 		return GetIntegralCompressFunctionResultSwitch<int32_t>(input_type, result_type);
-	case LogicalTypeId::BIGINT:
+	case PhysicalType::INT64:
 		return GetIntegralCompressFunctionResultSwitch<int64_t>(input_type, result_type);
-	case LogicalTypeId::HUGEINT:
+	case PhysicalType::INT128:
 		return GetIntegralCompressFunctionResultSwitch<hugeint_t>(input_type, result_type);
-	case LogicalTypeId::USMALLINT:
+	case PhysicalType::UINT16:
 		return GetIntegralCompressFunctionResultSwitch<uint16_t>(input_type, result_type);
-	case LogicalTypeId::UINTEGER:
+	case PhysicalType::UINT32:
 		return GetIntegralCompressFunctionResultSwitch<uint32_t>(input_type, result_type);
-	case LogicalTypeId::UBIGINT:
+	case PhysicalType::UINT64:
 		return GetIntegralCompressFunctionResultSwitch<uint64_t>(input_type, result_type);
-	case LogicalTypeId::UHUGEINT:
+	case PhysicalType::UINT128:
 		return GetIntegralCompressFunctionResultSwitch<uhugeint_t>(input_type, result_type);
 	default:
 		throw InternalException("Unexpected input type in GetIntegralCompressFunctionInputSwitch");
@@ -136,22 +137,22 @@ static scalar_function_t GetIntegralDecompressFunction(const LogicalType &input_
 template <class INPUT_TYPE>
 static scalar_function_t GetIntegralDecompressFunctionResultSwitch(const LogicalType &input_type,
                                                                    const LogicalType &result_type) {
-	switch (result_type.id()) {
-	case LogicalTypeId::SMALLINT:
+	switch (result_type.InternalType()) {
+	case PhysicalType::INT16:
 		return GetIntegralDecompressFunction<INPUT_TYPE, int16_t>(input_type, result_type);
-	case LogicalTypeId::INTEGER:
+	case PhysicalType::INT32:
 		return GetIntegralDecompressFunction<INPUT_TYPE, int32_t>(input_type, result_type);
-	case LogicalTypeId::BIGINT:
+	case PhysicalType::INT64:
 		return GetIntegralDecompressFunction<INPUT_TYPE, int64_t>(input_type, result_type);
-	case LogicalTypeId::HUGEINT:
+	case PhysicalType::INT128:
 		return GetIntegralDecompressFunction<INPUT_TYPE, hugeint_t>(input_type, result_type);
-	case LogicalTypeId::USMALLINT:
+	case PhysicalType::UINT16:
 		return GetIntegralDecompressFunction<INPUT_TYPE, uint16_t>(input_type, result_type);
-	case LogicalTypeId::UINTEGER:
+	case PhysicalType::UINT32:
 		return GetIntegralDecompressFunction<INPUT_TYPE, uint32_t>(input_type, result_type);
-	case LogicalTypeId::UBIGINT:
+	case PhysicalType::UINT64:
 		return GetIntegralDecompressFunction<INPUT_TYPE, uint64_t>(input_type, result_type);
-	case LogicalTypeId::UHUGEINT:
+	case PhysicalType::UINT128:
 		return GetIntegralDecompressFunction<INPUT_TYPE, uhugeint_t>(input_type, result_type);
 	default:
 		throw InternalException("Unexpected input type in GetIntegralDecompressFunctionSetSwitch");
@@ -199,7 +200,11 @@ ScalarFunction CMIntegralCompressFun::GetFunction(const LogicalType &input_type,
 
 static ScalarFunctionSet GetIntegralCompressFunctionSet(const LogicalType &result_type) {
 	ScalarFunctionSet set(IntegralCompressFunctionName(result_type));
-	for (const auto &input_type : LogicalType::Integral()) {
+	auto input_types = LogicalType::Integral();
+	for (const auto &temporal_type : CompressedMaterializationFunctions::TemporalTypes()) {
+		input_types.push_back(temporal_type);
+	}
+	for (const auto &input_type : input_types) {
 		if (GetTypeIdSize(result_type.InternalType()) < GetTypeIdSize(input_type.InternalType())) {
 			set.AddFunction(CMIntegralCompressFun::GetFunction(input_type, result_type));
 		}
@@ -233,7 +238,11 @@ static ScalarFunctionSet GetIntegralDecompressFunctionSet(const LogicalType &res
 }
 
 void CMIntegralDecompressFun::RegisterFunction(BuiltinFunctions &set) {
-	for (const auto &result_type : LogicalType::Integral()) {
+	auto result_types = LogicalType::Integral();
+	for (const auto &temporal_type : CompressedMaterializationFunctions::TemporalTypes()) {
+		result_types.push_back(temporal_type);
+	}
+	for (const auto &result_type : result_types) {
 		if (GetTypeIdSize(result_type.InternalType()) > 1) {
 			set.AddFunction(GetIntegralDecompressFunctionSet(result_type));
 		}
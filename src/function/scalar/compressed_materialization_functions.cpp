@@ -11,6 +11,11 @@ const vector<LogicalType> CompressedMaterializationFunctions::StringTypes() {
 	        LogicalType::HUGEINT};
 }
 
+const vector<LogicalType> CompressedMaterializationFunctions::TemporalTypes() {
+	return {LogicalType::DATE,        LogicalType::TIME,         LogicalType::TIMESTAMP,   LogicalType::TIMESTAMP_TZ,
+	        LogicalType::TIMESTAMP_S, LogicalType::TIMESTAMP_MS, LogicalType::TIMESTAMP_NS};
+}
+
 // LCOV_EXCL_START
 unique_ptr<FunctionData> CompressedMaterializationFunctions::Bind(ClientContext &context,
                                                                   ScalarFunction &bound_function,
@@ -0,0 +1,79 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryMemoryData : public GlobalTableFunctionState {
+	DuckDBQueryMemoryData() : offset(0) {
+	}
+
+	vector<QueryMemoryInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query_memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservation_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("admission");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("admitted_budget_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryMemoryData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetQueryMemoryInformation();
+	return std::move(result);
+}
+
+void DuckDBQueryMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryMemoryData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query_memory_limit_bytes, BIGINT
+		output.SetValue(col++, count,
+		                entry.memory_limit.IsValid()
+		                    ? Value::BIGINT(NumericCast<int64_t>(entry.memory_limit.GetIndex()))
+		                    : Value());
+		// reservation_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.reservation)));
+		// admission, VARCHAR
+		if (entry.waiting) {
+			output.SetValue(col++, count, Value("WAITING"));
+		} else if (entry.admitted) {
+			output.SetValue(col++, count, Value("ADMITTED"));
+		} else {
+			output.SetValue(col++, count, Value());
+		}
+		// admitted_budget_bytes, BIGINT
+		output.SetValue(col++, count,
+		                entry.admitted ? Value::BIGINT(NumericCast<int64_t>(entry.admitted_budget)) : Value());
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryMemoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_memory", {}, DuckDBQueryMemoryFunction, DuckDBQueryMemoryBind,
+	                              DuckDBQueryMemoryInit));
+}
+
+} // namespace duckdb
@@ -12,6 +12,9 @@
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -271,6 +274,190 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Ordered Index Scan
+//===--------------------------------------------------------------------===//
+struct OrderedIndexScanGlobalState : public GlobalTableFunctionState {
+	explicit OrderedIndexScanGlobalState(ART &index) : index(index), row_ids_offset(0), finished(false) {
+	}
+
+	//! The index whose key order the scan follows
+	ART &index;
+	ARTOrderedScanState index_state;
+	//! The row ids of the current batch of keys
+	unsafe_vector<row_t> row_ids;
+	idx_t row_ids_offset;
+	//! The dynamic filter on the key column (if any), its constant tightens the upper bound of the index scan
+	shared_ptr<DynamicFilterData> dynamic_filter;
+	ColumnFetchState fetch_state;
+	TableScanState local_storage_state;
+	vector<storage_t> column_ids;
+	vector<idx_t> projection_ids;
+	DataChunk all_columns;
+	bool finished;
+};
+
+//! Tightens the bounds of the index scan with a comparison on the key column
+static void TightenOrderedIndexScanBounds(ARTOrderedScanState &state, const ConstantFilter &filter) {
+	auto &constant = filter.constant;
+	bool set_lower = false;
+	bool set_upper = false;
+	switch (filter.comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		set_lower = true;
+		set_upper = true;
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		set_lower = true;
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		set_upper = true;
+		break;
+	default:
+		throw InternalException("Unsupported comparison for ordered index scan");
+	}
+	auto equal = filter.comparison_type == ExpressionType::COMPARE_EQUAL ||
+	             filter.comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+	             filter.comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	if (set_lower && (state.lower_bound.IsNull() || constant > state.lower_bound ||
+	                  (constant == state.lower_bound && !equal))) {
+		state.lower_bound = constant;
+		state.lower_equal = equal;
+	}
+	if (set_upper && (state.upper_bound.IsNull() || constant < state.upper_bound ||
+	                  (constant == state.upper_bound && !equal))) {
+		state.upper_bound = constant;
+		state.upper_equal = equal;
+	}
+}
+
+static void InitializeOrderedIndexScanBounds(OrderedIndexScanGlobalState &state, TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		TightenOrderedIndexScanBounds(state.index_state, filter.Cast<ConstantFilter>());
+		break;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction.child_filters) {
+			InitializeOrderedIndexScanBounds(state, *child);
+		}
+		break;
+	}
+	case TableFilterType::DYNAMIC_FILTER:
+		state.dynamic_filter = filter.Cast<DynamicFilter>().filter_data;
+		break;
+	default:
+		// the index does not contain NULL values, and the planner only chooses an ordered index scan if the remaining
+		// filters are optional
+		break;
+	}
+}
+
+static unique_ptr<GlobalTableFunctionState> OrderedIndexScanInitGlobal(ClientContext &context,
+                                                                       TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto &storage = bind_data.table.GetStorage();
+	auto &info = storage.GetDataTableInfo();
+
+	optional_ptr<ART> index;
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		if (art_index.GetIndexName() != bind_data.order_index_name) {
+			return false;
+		}
+		index = &art_index;
+		return true;
+	});
+	if (!index) {
+		throw InternalException("Could not find index \"%s\" for ordered index scan", bind_data.order_index_name);
+	}
+
+	auto result = make_uniq<OrderedIndexScanGlobalState>(*index);
+	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
+
+	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
+	result->column_ids.reserve(input.column_ids.size());
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+		vector<LogicalType> scanned_types;
+		const auto &columns = bind_data.table.GetColumns();
+		for (const auto &col_idx : input.column_ids) {
+			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				scanned_types.emplace_back(LogicalType::ROW_TYPE);
+			} else {
+				scanned_types.push_back(columns.GetColumn(LogicalIndex(col_idx)).Type());
+			}
+		}
+		result->all_columns.Initialize(context, scanned_types);
+	}
+
+	// the filters on the key column of the index become the bounds of the index scan
+	auto key_column = index->GetColumnIds()[0];
+	if (input.filters) {
+		for (auto &entry : input.filters->filters) {
+			if (input.column_ids[entry.first] == key_column) {
+				InitializeOrderedIndexScanBounds(*result, *entry.second);
+			}
+		}
+	}
+
+	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
+	local_storage.InitializeScan(storage, result->local_storage_state.local_state, input.filters);
+	return std::move(result);
+}
+
+static void OrderedIndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.global_state->Cast<OrderedIndexScanGlobalState>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+	auto remove_filter_columns = !state.projection_ids.empty();
+	auto &result = remove_filter_columns ? state.all_columns : output;
+
+	while (!state.finished) {
+		if (state.row_ids_offset == state.row_ids.size()) {
+			// fetch the row ids of the next batch of keys
+			if (state.dynamic_filter) {
+				auto filter = state.dynamic_filter->GetFilter();
+				if (filter) {
+					TightenOrderedIndexScanBounds(state.index_state, *filter);
+				}
+			}
+			state.row_ids.clear();
+			state.row_ids_offset = 0;
+			state.index.ScanOrdered(state.index_state, STANDARD_VECTOR_SIZE, state.row_ids);
+			if (state.row_ids.empty()) {
+				D_ASSERT(state.index_state.finished);
+				state.finished = true;
+				break;
+			}
+		}
+
+		auto remaining = state.row_ids.size() - state.row_ids_offset;
+		auto scan_count = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.row_ids_offset));
+		result.Reset();
+		bind_data.table.GetStorage().Fetch(transaction, result, state.column_ids, row_ids, scan_count,
+		                                   state.fetch_state);
+		state.row_ids_offset += scan_count;
+		if (result.size() > 0) {
+			break;
+		}
+	}
+	if (result.size() == 0) {
+		// the rows appended by this transaction are not part of the index
+		result.Reset();
+		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, result);
+	}
+	if (remove_filter_columns) {
+		output.ReferenceColumns(state.all_columns, state.projection_ids);
+	}
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -384,6 +571,7 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
 	serializer.WriteProperty(105, "result_ids", bind_data.row_ids);
+	serializer.WritePropertyWithDefault<string>(106, "order_index_name", bind_data.order_index_name);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -399,6 +587,7 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
 	deserializer.ReadProperty(105, "result_ids", result->row_ids);
+	deserializer.ReadPropertyWithDefault(106, "order_index_name", result->order_index_name);
 	return std::move(result);
 }
 
@@ -421,6 +610,26 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetOrderedIndexScanFunction() {
+	TableFunction scan_function("ordered_index_scan", {}, OrderedIndexScanFunction);
+	scan_function.init_local = nullptr;
+	scan_function.init_global = OrderedIndexScanInitGlobal;
+	scan_function.statistics = TableScanStatistics;
+	scan_function.dependency = TableScanDependency;
+	scan_function.cardinality = TableScanCardinality;
+	scan_function.pushdown_complex_filter = nullptr;
+	scan_function.to_string = TableScanToString;
+	scan_function.table_scan_progress = nullptr;
+	scan_function.get_batch_index = nullptr;
+	scan_function.projection_pushdown = true;
+	scan_function.filter_pushdown = true;
+	scan_function.filter_prune = true;
+	scan_function.get_bind_info = TableScanGetBindInfo;
+	scan_function.serialize = TableScanSerialize;
+	scan_function.deserialize = TableScanDeserialize;
+	return scan_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -447,6 +656,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetOrderedIndexScanFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy that decides which persistent blocks are evicted first from the buffer pool
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently unpinned block first
+	LRU = 0,
+	//! Evict blocks that were used only once (e.g. by a sequential scan) before blocks that were used repeatedly
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
@@ -68,6 +68,7 @@ public:
 	DUCKDB_API void Truncate(int64_t new_size);
 	DUCKDB_API string ReadLine();
 	DUCKDB_API bool Trim(idx_t offset_bytes, idx_t length_bytes);
+	DUCKDB_API void ReadAhead(idx_t location, idx_t nr_bytes);
 	DUCKDB_API virtual idx_t GetProgress();
 	DUCKDB_API virtual FileCompressionType GetFileCompressionType();
 
@@ -126,6 +127,9 @@ public:
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
+	//! Hint that a range of the file will be read soon. The file-system can start reading the range in the background
+	//! (e.g. into the page-cache), this call does not block on the read.
+	DUCKDB_API virtual void ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes);
 
 	//! Returns the file size of a file handle, returns -1 on error
 	DUCKDB_API virtual int64_t GetFileSize(FileHandle &handle);
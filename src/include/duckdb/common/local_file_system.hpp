@@ -33,6 +33,8 @@ public:
 	//! range (sparse file support). Reads to the range will succeed but will return
 	//! undefined data.
 	bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) override;
+	//! Hint the OS to read a range of the file into the page-cache in the background
+	void ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
 
 	//! Returns the file size of a file handle, returns -1 on error
 	int64_t GetFileSize(FileHandle &handle) override;
@@ -0,0 +1,17 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+//! Software prefetch hint: requests the cache line containing 'addr' for reading. Prefetching never faults, so
+//! invalid or null addresses are allowed. Compiles to nothing on compilers without a prefetch builtin.
+#if defined(__GNUC__) || defined(__clang__)
+#define DUCKDB_PREFETCH(addr) (__builtin_prefetch(static_cast<const void *>(addr), 0, 3))
+#else
+#define DUCKDB_PREFETCH(addr) ((void)(addr))
+#endif
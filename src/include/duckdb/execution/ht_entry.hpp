@@ -95,8 +95,9 @@ private:
 };
 
 // uses an AND operation to apply the modulo operation instead of an if condition that could be branch mispredicted
+// bits outside of the capacity mask (i.e., the salt and the region of a partitioned pointer table) are left intact
 inline void IncrementAndWrap(idx_t &offset, const uint64_t &capacity_mask) {
-	++offset &= capacity_mask;
+	offset = (offset & ~capacity_mask) | ((offset + 1) & capacity_mask);
 }
 
 } // namespace duckdb
@@ -29,6 +29,21 @@ class FixedSizeAllocator;
 
 struct ARTIndexScanState;
 
+//! The state of a scan over the row IDs of the ART in key order. The scan fetches the row IDs in batches, and each
+//! batch continues after the last key of the previous batch.
+struct ARTOrderedScanState {
+	//! The lower bound of the keys, or NULL, if there is no lower bound.
+	Value lower_bound;
+	bool lower_equal = true;
+	//! The upper bound of the keys, or NULL, if there is no upper bound. It can change between batches.
+	Value upper_bound;
+	bool upper_equal = true;
+	//! The last key of the previous batch.
+	unsafe_vector<uint8_t> last_key;
+	//! True, if the scan reached the upper bound or the end of the ART.
+	bool finished = false;
+};
+
 class ART : public BoundIndex {
 public:
 	friend class Leaf;
@@ -70,6 +85,12 @@ public:
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Fetches the row IDs of the next batch of keys in key order. A batch holds all row IDs of its keys, and it holds
+	//! at least max_count row IDs, unless it is the last batch. Returns false, if there are no more keys to scan.
+	bool ScanOrdered(ARTOrderedScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Perform a point lookup for each key of the input chunk, which holds the key column of the ART.
+	//! Fetches the row IDs matching the key at row i into row_ids[i]. NULL keys do not match any row IDs.
+	void SearchEqual(DataChunk &input, vector<unsafe_vector<row_t>> &row_ids);
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
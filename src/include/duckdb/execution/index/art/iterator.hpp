@@ -66,6 +66,11 @@ public:
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
 	//! If upper_bound is the empty ARTKey, than there is no upper bound.
 	bool Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal);
+	//! Scans the tree in key order, starting at the current leaf, and ending at upper_bound. Only stops at the end of
+	//! a key, after it scanned at least max_count row IDs, and copies that key into last_key.
+	//! Returns true, if the scan stopped before reaching the upper bound or the end of the tree.
+	bool ScanBatch(const ARTKey &upper_bound, const bool equal, const idx_t max_count, unsafe_vector<row_t> &row_ids,
+	               unsafe_vector<uint8_t> &last_key);
 	//! Finds the minimum (leaf) of the current subtree.
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
@@ -97,5 +102,11 @@ private:
 	bool Next();
 	//! Pop the top node from the stack of iterator entries and adjust the current key.
 	void PopNode();
+	//! Adds the row IDs of last_leaf to row_ids. Returns false, if that exceeds max_count.
+	bool GetRowIds(const idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Returns the length of the current key without the bytes of a nested leaf.
+	idx_t GetKeyLength() const {
+		return status == GateStatus::GATE_SET ? current_key.Size() - nested_depth : current_key.Size();
+	}
 };
 } // namespace duckdb
@@ -42,9 +42,9 @@ public:
 	static void DeleteByte(ART &art, Node &node, const uint8_t byte);
 
 	//! Returns true, if the byte exists, else false.
-	bool HasByte(uint8_t &byte);
+	bool HasByte(uint8_t &byte) const;
 	//! Get the first byte greater or equal to the byte.
-	bool GetNextByte(uint8_t &byte);
+	bool GetNextByte(uint8_t &byte) const;
 
 private:
 	static Node256Leaf &GrowNode15Leaf(ART &art, Node &node256_leaf, Node &node15_leaf);
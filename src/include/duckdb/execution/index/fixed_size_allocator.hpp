@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -55,6 +57,9 @@ public:
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (unloaded_buffer_count != 0) {
+			LoadBuffer(buffer);
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
@@ -98,6 +103,9 @@ public:
 	idx_t GetUpperBoundBufferId() const;
 	//! Merge another FixedSizeAllocator into this allocator. Both must have the same segment size
 	void Merge(FixedSizeAllocator &other);
+	//! Merge another FixedSizeAllocator into this allocator, and add the offset to the IDs of its buffers. The
+	//! resulting buffer IDs must not exist in this allocator
+	void Merge(FixedSizeAllocator &other, const idx_t buffer_id_offset);
 
 	//! Initialize a vacuum operation, and return true, if the allocator needs a vacuum
 	bool InitializeVacuum();
@@ -154,9 +162,19 @@ private:
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
 
+	//! The number of buffers that are not in memory. Once all buffers are in memory, concurrent readers of the
+	//! index no longer need to take the load lock
+	atomic<idx_t> unloaded_buffer_count;
+	//! Lock to load buffers into memory, as concurrent readers can load the same buffer
+	mutex load_lock;
+
 private:
 	//! Returns an available buffer id
 	idx_t GetAvailableBufferId() const;
+	//! Loads a buffer into memory, if it is not in memory
+	void LoadBuffer(FixedSizeBuffer &buffer);
+	//! Recounts the buffers that are not in memory
+	void CountUnloadedBuffers();
 };
 
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -21,6 +22,7 @@
 
 namespace duckdb {
 
+class BlockedBloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -157,6 +159,37 @@ public:
 		TupleDataChunkState chunk_state;
 	};
 
+	//! HeavyHitters estimates the most frequent hashes of the build side (i.e., the keys that are heavily skewed),
+	//! using the space-saving algorithm (like approx_top_k) on a sample of the rows
+	struct HeavyHitters {
+	public:
+		//! The number of hashes that are monitored
+		static constexpr const idx_t CAPACITY = 32;
+		//! Only every SAMPLE_RATE'th row is added to the sketch
+		static constexpr const idx_t SAMPLE_RATE = 16;
+
+	public:
+		//! Add a sample of the given hashes to the sketch
+		void Sample(Vector &hashes, const SelectionVector &sel, idx_t count);
+		//! Merge another sketch into this one
+		void Combine(const HeavyHitters &other);
+		//! Estimate (a lower bound of) the number of rows of the heavy hitters that fall into the given partition
+		idx_t EstimateCount(idx_t radix_bits, idx_t partition_idx) const;
+
+	private:
+		void Add(hash_t hash, idx_t increment);
+
+	private:
+		//! The monitored hashes and their (overestimated) sample counts
+		hash_t hashes[CAPACITY];
+		idx_t counts[CAPACITY];
+		idx_t size = 0;
+		//! The total number of sampled rows
+		idx_t sample_count = 0;
+		//! The offset of the next sampled row in the next chunk
+		idx_t sample_offset = 0;
+	};
+
 	JoinHashTable(ClientContext &context, const vector<JoinCondition> &conditions, vector<LogicalType> build_types,
 	              JoinType type, const vector<idx_t> &output_columns);
 	~JoinHashTable();
@@ -171,8 +204,9 @@ public:
 	void InitializePointerTable();
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
-	//! ever called.
-	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel);
+	//! ever called. If "partitioned" is true, the chunks cover whole regions of the pointer table, and no other
+	//! thread touches these regions, so the pointer table is built without atomic operations
+	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel, bool partitioned = false);
 	//! Probe the HT with the given input chunk, resulting in the given result
 	void Probe(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	           optional_ptr<Vector> precomputed_hashes = nullptr);
@@ -253,10 +287,19 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
-	//! Bitmask for getting relevant bits from the hashes to determine the position
+	//! Bitmask for getting relevant bits from the hashes to determine the position within a region of the pointer table
 	uint64_t bitmask = DConstants::INVALID_INDEX;
+	//! The pointer table can be divided into regions by the radix bits of the hash, with each region only containing
+	//! the entries of the rows of the corresponding partitions. This is the mask of the radix bits that select the
+	//! region, and the shift that moves them to the position of the region in the pointer table
+	hash_t region_mask = 0;
+	idx_t region_shift = 0;
 	//! Whether or not we error on multiple rows found per match in a SINGLE join
 	bool single_join_error_on_multiple_rows = true;
+	//! Bloom filter that is filled with the hashes of the keys during Finalize (if any)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
+	//! The most frequent hashes of the build side
+	HeavyHitters heavy_hitters;
 
 	struct {
 		mutex mj_lock;
@@ -345,6 +388,10 @@ public:
 	public:
 		//! Prepare the next probe round
 		void PrepareNextProbe();
+		//! Returns the partitions of the probe data (partitions that were probed already are moved out)
+		vector<unique_ptr<ColumnDataCollection>> &GetPartitions() {
+			return global_partitions->GetPartitions();
+		}
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
@@ -379,6 +426,38 @@ public:
 		return partition_end;
 	}
 
+	//! Whether the partitions of a round may be built in multiple parts if they do not fit in memory. Every part is
+	//! probed with all probe-side rows of the round, which is only correct if a probe row can match multiple rows
+	//! independently, and unmatched rows do not produce output
+	bool CanSplitRounds() const {
+		return join_type == JoinType::INNER;
+	}
+	//! Whether the partitions of the current round are built in multiple parts
+	bool IsSplitRound() const {
+		return split_round;
+	}
+	//! Whether the current part is the first/last part of the current round (always true if the round is not split)
+	bool IsFirstPart() const {
+		return !split_round || split_chunk_start == 0;
+	}
+	bool IsLastPart() const {
+		return !split_round || split_chunk_end == data_collection->ChunkCount();
+	}
+	//! Returns the range of chunks in the data collection that is built in the current round (or part)
+	void GetBuildChunkRange(idx_t &chunk_idx_from, idx_t &chunk_idx_to) const;
+
+	//! Returns the number of regions of the pointer table
+	idx_t GetRegionCount() const {
+		return RadixPartitioning::NumberOfPartitions(region_radix_bits);
+	}
+	//! Returns the range of chunks in the data collection that contains the rows of the given regions
+	void GetRegionChunkRange(idx_t region_idx_from, idx_t region_idx_to, idx_t &chunk_idx_from,
+	                         idx_t &chunk_idx_to) const;
+	//! Returns the position of the hash in the pointer table
+	inline idx_t GetPointerTableOffset(hash_t hash) const {
+		return (hash & bitmask) | ((hash & region_mask) >> region_shift);
+	}
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -406,6 +485,9 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Moves the next partitions (up to partition_end) to the data collection without building them, so that they can
+	//! be scanned to probe a HT that was built on the probe side of these partitions instead
+	void PrepareExternalScan(const idx_t partition_end);
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	void ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
@@ -418,6 +500,23 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+
+	//! The number of chunks of each partition in the data collection (if it is ordered by partition)
+	vector<idx_t> partition_chunk_counts;
+	//! The number of rows of each partition in the data collection (if it is ordered by partition)
+	vector<idx_t> partition_counts;
+	//! The number of radix bits that divide the pointer table into regions
+	idx_t region_radix_bits = 0;
+
+	//! If a single partition does not fit in memory (e.g., because of a heavy hitter), the round is split into parts,
+	//! each building a range of chunks of the data collection
+	bool split_round = false;
+	idx_t split_chunk_start = 0;
+	idx_t split_chunk_end = 0;
+	//! Returns the end of the next part of a split round, given the maximum size of the HT
+	idx_t GetSplitChunkEnd(const idx_t max_ht_size) const;
+	//! Returns the maximum number of rows in a part of a split round
+	idx_t GetSplitCount() const;
 };
 
 } // namespace duckdb
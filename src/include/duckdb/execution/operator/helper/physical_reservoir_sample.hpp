@@ -41,7 +41,8 @@ public:
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
 	bool ParallelSink() const override {
-		return true;
+		// a sample with a seed must see the rows in the same order to be repeatable
+		return options->seed == -1;
 	}
 
 	bool IsSink() const override {
@@ -13,6 +13,7 @@
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
 struct GlobalUngroupedAggregateState;
@@ -54,6 +55,11 @@ public:
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
 	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+
+	//! Creates an empty bloom filter for the build-side keys, or nullptr if we cannot push a bloom filter
+	shared_ptr<BlockedBloomFilter> CreateBloomFilter(idx_t condition_count, idx_t build_count) const;
+	//! Pushes the (filled) bloom filter into the probe-side scan
+	void PushBloomFilter(shared_ptr<BlockedBloomFilter> bloom_filter, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
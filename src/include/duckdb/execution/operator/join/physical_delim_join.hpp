@@ -8,12 +8,40 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 
 namespace duckdb {
 
 class PhysicalHashAggregate;
 
+//! Global state for the filters on the duplicate eliminated columns that are pushed into scans on the delim side
+struct DelimJoinFilterGlobalState {
+	//! The min/max states (one per JoinFilterPushdownInfo)
+	vector<unique_ptr<JoinFilterGlobalState>> filter_states;
+
+	mutex lock;
+	//! The hashes of the duplicate eliminated columns that we create bloom filters for
+	vector<vector<hash_t>> hashes;
+	//! The amount of rows for which hashes have been collected
+	atomic<idx_t> hash_count {0};
+};
+
+struct DelimJoinFilterLocalState {
+	DelimJoinFilterLocalState() : hash_vector(LogicalType::HASH) {
+	}
+
+	//! The duplicate eliminated columns of the sunk chunk
+	DataChunk delim_columns;
+	//! The min/max states (one per JoinFilterPushdownInfo)
+	vector<unique_ptr<JoinFilterLocalState>> filter_states;
+	//! The hashes of the duplicate eliminated columns that we create bloom filters for
+	vector<vector<hash_t>> hashes;
+	Vector hash_vector;
+};
+
 //! PhysicalDelimJoin represents a join where either the LHS or RHS will be duplicate eliminated and pushed into a
 //! PhysicalColumnDataScan in the other side. Implementations are PhysicalLeftDelimJoin and PhysicalRightDelimJoin
 class PhysicalDelimJoin : public PhysicalOperator {
@@ -28,9 +56,28 @@ public:
 
 	optional_idx delim_idx;
 
+	//! Filters on the duplicate eliminated columns that are pushed into scans on the delim side (if any)
+	vector<unique_ptr<JoinFilterPushdownInfo>> filter_pushdown;
+	//! The duplicate eliminated columns that we create bloom filters for
+	vector<idx_t> bloom_filter_columns;
+
+	//! From this amount of collected hashes onwards we no longer create bloom filters
+	static constexpr const idx_t MAXIMUM_BLOOM_FILTER_COUNT = 1ULL << 22ULL;
+
 public:
 	vector<const_reference<PhysicalOperator>> GetChildren() const override;
 
+	//! Sets the filters on the duplicate eliminated columns that are pushed into scans on the delim side
+	void SetFilterPushdown(vector<unique_ptr<JoinFilterPushdownInfo>> filter_pushdown);
+	unique_ptr<DelimJoinFilterGlobalState> GetFilterGlobalState(ClientContext &context) const;
+	unique_ptr<DelimJoinFilterLocalState> GetFilterLocalState(DelimJoinFilterGlobalState &gstate) const;
+	void SinkFilters(DataChunk &chunk, DelimJoinFilterGlobalState &gstate, DelimJoinFilterLocalState &lstate) const;
+	void CombineFilters(DelimJoinFilterGlobalState &gstate, DelimJoinFilterLocalState &lstate) const;
+	//! Pushes the min/max (and bloom) filters on the duplicate eliminated columns into the scans
+	void PushFilters(DelimJoinFilterGlobalState &gstate) const;
+	//! Makes the pipelines that scan the filtered tables depend on the pipeline that sinks into this delim join
+	void AddFilterDependencies(MetaPipeline &meta_pipeline, Pipeline &delim_pipeline) const;
+
 	bool IsSink() const override {
 		return true;
 	}
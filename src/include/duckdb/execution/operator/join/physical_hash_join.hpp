@@ -34,6 +34,10 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Whether the build and probe side can swap roles at runtime (only for external inner equi-joins)
+	bool CanReverseBuildAndProbe() const;
+	//! Initialize a HT on the probe side for this operator, used when the build and probe side swap roles
+	unique_ptr<JoinHashTable> InitializeReversedHashTable(ClientContext &context) const;
 
 	//! The types of the join keys
 	vector<LogicalType> condition_types;
@@ -47,6 +51,8 @@ public:
 	vector<idx_t> rhs_output_columns;
 	//! The types of the output
 	vector<LogicalType> rhs_output_types;
+	//! Positions of the LHS columns in the HT that is built on the probe side when the build and probe side swap roles
+	vector<idx_t> lhs_output_columns;
 
 	//! Duplicate eliminated types; only used for delim_joins (i.e. correlated subqueries)
 	vector<LogicalType> delim_types;
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+class ART;
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an inner equality join between an outer side and a base table with an ART index on
+//! the join key. Instead of building a hash table over the table, the join keys of the outer side are looked up in the
+//! index, and the matching rows are fetched from the table. The rows that the transaction appended to the table are not
+//! in the index yet, they are looked up in an index over the transaction-local rows.
+//! NOTE: committed deletes remove their rows from the index, even if older transactions can still see them. Index joins
+//! are not planned for these transactions, but a plan that was created before the delete committed can miss the rows.
+class PhysicalIndexJoin : public CachingPhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> outer, unique_ptr<Expression> outer_key,
+	                  DuckTableEntry &table, ART &index, vector<column_t> fetch_ids, vector<LogicalType> fetch_types,
+	                  vector<idx_t> outer_projection, vector<idx_t> inner_projection, bool inner_is_left,
+	                  idx_t estimated_cardinality);
+
+	//! The join key of the outer side, which is looked up in the index
+	unique_ptr<Expression> outer_key;
+	//! The table that is joined through its index
+	DuckTableEntry &table;
+	//! The index on the join key of the table
+	ART &index;
+	//! The storage column ids that are fetched from the table, followed by the row id column
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! The columns of the outer side that are part of the result
+	vector<idx_t> outer_projection;
+	//! The fetched columns of the table that are part of the result
+	vector<idx_t> inner_projection;
+	//! Whether the table was the left side of the join, i.e., whether its columns come first in the result
+	bool inner_is_left;
+
+public:
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+};
+
+} // namespace duckdb
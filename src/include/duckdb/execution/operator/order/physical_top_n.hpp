@@ -12,6 +12,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+class DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +27,9 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter on the first ORDER BY column that is pushed into the scan (if any)
+	//! Its constant is tightened to the boundary of the heap whenever the heap is reduced
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
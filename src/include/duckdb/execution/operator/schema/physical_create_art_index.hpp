@@ -56,11 +56,16 @@ public:
 
 	//! Sink for unsorted data: insert iteratively
 	SinkResultType SinkUnsorted(OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
+	//! Sink for sorted data: collect the keys of the batch
 	SinkResultType SinkSorted(OperatorSinkInput &input) const;
+	//! Construct the ART of the current batch of sorted data
+	void ConstructBatch(LocalSinkState &local_state) const;
+	//! Combine for sorted data: move the ARTs of the batches into the global index
+	SinkCombineResultType CombineSorted(OperatorSinkCombineInput &input) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
 
@@ -70,5 +75,8 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+	bool RequiresBatchIndex() const override {
+		return sorted;
+	}
 };
 } // namespace duckdb
@@ -63,4 +63,9 @@ struct FSSTFun {
 	static bool TypeIsSupported(const PhysicalType physical_type);
 };
 
+struct ZSTDFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const PhysicalType physical_type);
+};
+
 } // namespace duckdb
@@ -18,6 +18,8 @@ struct CompressedMaterializationFunctions {
 	static const vector<LogicalType> IntegralTypes();
 	//! The types we compress strings to
 	static const vector<LogicalType> StringTypes();
+	//! The temporal types that we compress like integral types (using their physical representation)
+	static const vector<LogicalType> TemporalTypes();
 
 	static unique_ptr<FunctionData> Bind(ClientContext &context, ScalarFunction &bound_function,
 	                                     vector<unique_ptr<Expression>> &arguments);
@@ -29,11 +29,13 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch in case of an index scan.
 	unsafe_vector<row_t> row_ids;
+	//! The name of the index whose key order an ordered index scan follows.
+	string order_index_name;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && row_ids == other.row_ids;
+		return &other.table == &table && row_ids == other.row_ids && order_index_name == other.order_index_name;
 	}
 };
 
@@ -42,6 +44,7 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	static TableFunction GetOrderedIndexScanFunction();
 };
 
 } // namespace duckdb
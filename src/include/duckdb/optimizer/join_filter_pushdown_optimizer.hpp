@@ -12,10 +12,13 @@
 #include "duckdb/planner/column_binding_map.hpp"
 
 namespace duckdb {
+class LogicalGet;
+class LogicalTopN;
 class Optimizer;
+struct JoinFilterPushdownInfo;
 
-//! The JoinFilterPushdownOptimizer links comparison joins to data sources to enable dynamic execution-time filter
-//! pushdown
+//! The JoinFilterPushdownOptimizer links comparison joins and Top-N operators to data sources to enable dynamic
+//! execution-time filter pushdown
 class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
 public:
 	explicit JoinFilterPushdownOptimizer(Optimizer &optimizer);
@@ -24,8 +27,18 @@ public:
 
 private:
 	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Generates filters on the build side of a join from the duplicate eliminated columns of the enclosing delim join
+	void GenerateDelimJoinFilters(LogicalComparisonJoin &join);
+	bool GenerateMinMaxAggregates(JoinFilterPushdownInfo &pushdown_info,
+	                              vector<unique_ptr<Expression>> build_expressions);
+	void SetDynamicFilters(LogicalGet &get, JoinFilterPushdownInfo &pushdown_info);
+	//! Links the Top-N to the scan of its first ORDER BY column, so the boundary of its heap can be pushed into it
+	void GenerateTopNFilters(LogicalTopN &top_n);
 
 private:
 	Optimizer &optimizer;
+	//! The duplicate eliminated scans on the delim sides we are currently visiting (by table index), with the delim
+	//! join that they belong to
+	unordered_map<idx_t, reference<LogicalComparisonJoin>> delim_gets;
 };
 } // namespace duckdb
@@ -21,6 +21,7 @@ struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
+enum class ThreadPinMode : uint8_t;
 
 struct SchedulerThread;
 
@@ -37,6 +38,8 @@ struct ProducerToken {
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	// with ThreadPinMode::AUTO, threads are pinned if there are more CPUs than this
+	constexpr static idx_t THREAD_PIN_THRESHOLD = 64;
 
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
@@ -78,6 +81,8 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Sets whether the worker threads are pinned to CPUs, and (un)pins the running threads accordingly
+	void SetThreadPinMode(ThreadPinMode mode);
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
@@ -86,6 +91,10 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Whether the worker threads should be pinned with the current ThreadPinMode (must hold thread_lock)
+	bool PinThreads() const;
+	//! Pins the worker thread with the given index to a CPU, or allows it to run on all CPUs if !pin
+	void PinThread(idx_t thread_idx, bool pin);
 
 private:
 	DatabaseInstance &db;
@@ -105,6 +114,10 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! Whether the worker threads are pinned to CPUs
+	ThreadPinMode thread_pin_mode;
+	//! The CPUs that this process may run on (empty if unknown)
+	vector<idx_t> available_cpus;
 };
 
 } // namespace duckdb
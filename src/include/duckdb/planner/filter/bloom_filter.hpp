@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! A register-blocked bloom filter over hash values. Every hash selects a single 64-bit block in which it sets
+//! NUM_HASH_BITS bits, so an insert or a lookup only touches a single word of memory
+class BlockedBloomFilter {
+public:
+	//! Creates an empty bloom filter that is sized for "expected_count" distinct values
+	explicit BlockedBloomFilter(idx_t expected_count);
+	//! Creates a bloom filter from a previously serialized set of blocks
+	explicit BlockedBloomFilter(vector<uint64_t> blocks);
+
+	//! The number of bits we reserve per value
+	static constexpr const idx_t BITS_PER_VALUE = 16;
+	//! The number of bits that are set in the block per value
+	static constexpr const idx_t NUM_HASH_BITS = 3;
+	//! The maximum size of a bloom filter - we don't generate larger bloom filters
+	static constexpr const idx_t MAXIMUM_SIZE = 64ULL * 1024ULL * 1024ULL;
+
+public:
+	//! Returns the size (in bytes) of a bloom filter for "expected_count" values
+	static idx_t SizeInBytes(idx_t expected_count);
+
+	//! Inserts a (flat) vector of hashes into the bloom filter - uses atomic operations if "parallel" is true
+	void Insert(Vector &hashes, idx_t count, bool parallel);
+	//! Filters the selection vector down to the rows whose hash is possibly contained in the bloom filter
+	//! NULL values are never contained in the bloom filter
+	idx_t Filter(Vector &input, SelectionVector &sel, idx_t approved_tuple_count, idx_t scan_count) const;
+
+	inline bool Lookup(hash_t hash) const {
+		auto mask = GetMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+	const vector<uint64_t> &GetBlocks() const {
+		return blocks;
+	}
+
+private:
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return (hash >> (NUM_HASH_BITS * 6)) & block_mask;
+	}
+	static inline uint64_t GetMask(hash_t hash) {
+		uint64_t mask = 0;
+		for (idx_t i = 0; i < NUM_HASH_BITS; i++) {
+			mask |= uint64_t(1) << ((hash >> (i * 6)) & 63);
+		}
+		return mask;
+	}
+
+private:
+	//! The blocks of the bloom filter (the amount of blocks is always a power of two)
+	vector<uint64_t> blocks;
+	//! Mask used to find the block of a hash
+	idx_t block_mask;
+};
+
+//! BloomFilter filters out values whose hash is definitely not contained in a BlockedBloomFilter
+//! Note that this filter can have false positives: it can only be used as an additional (pre-)filter
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> bloom_filter);
+
+	//! The (shared, immutable) bloom filter
+	shared_ptr<BlockedBloomFilter> bloom_filter;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! The (shared) state of a dynamic filter: a comparison with a constant that is tightened while the query runs
+//! Initially the filter does not have a constant, and does not filter out any rows
+class DynamicFilterData {
+public:
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	//! The comparison type (COMPARE_GREATERTHANOREQUALTO or COMPARE_LESSTHANOREQUALTO)
+	const ExpressionType comparison_type;
+
+public:
+	//! Sets the constant of the filter to "value", if that filters out more rows than the current constant
+	void Update(const Value &value);
+	//! Removes the constant of the filter
+	void Reset();
+	//! Returns the current comparison, or nullptr if no constant has been set yet
+	unique_ptr<ConstantFilter> GetFilter() const;
+
+private:
+	mutable mutex lock;
+	//! The current comparison (if any)
+	unique_ptr<ConstantFilter> filter;
+};
+
+//! DynamicFilter filters out values that do not satisfy the current comparison of a DynamicFilterData
+//! The comparison only ever becomes more selective, so rows that are filtered out can never become relevant again
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The (shared) filter data, which is updated by the operator that created the filter
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
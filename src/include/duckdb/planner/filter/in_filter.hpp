@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class BlockedBloomFilter;
+
+//! InFilter represents a set-membership filter (e.g. x IN (1, 7, 42, ...)) pushed down into the table scan
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+	//! From this amount of values onwards we first probe a bloom filter before searching the sorted values
+	static constexpr const idx_t BLOOM_FILTER_THRESHOLD = 64;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (sorted, distinct, non-NULL) set of values to filter on
+	vector<Value> values;
+
+public:
+	//! Whether or not an InFilter can be created for values of the given type
+	static bool SupportsType(const LogicalType &type);
+	//! Filters the selection vector down to the rows whose value is contained in the set
+	idx_t Filter(Vector &input, SelectionVector &sel, idx_t approved_tuple_count, idx_t scan_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The values as a (sorted) vector, used for the vectorized lookups
+	unique_ptr<Vector> sorted_values;
+	//! Bloom filter over the hashes of the values (only for large sets)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
+};
+
+} // namespace duckdb
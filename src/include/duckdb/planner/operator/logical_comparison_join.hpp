@@ -38,6 +38,9 @@ public:
 	bool convert_mark_to_semi = true;
 	//! Scans where we should push generated filters into (if any)
 	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
+	//! (If this is a DelimJoin) Scans on the delim side where we should push filters on the duplicate eliminated
+	//! columns into (if any)
+	vector<unique_ptr<JoinFilterPushdownInfo>> delim_filter_pushdown;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
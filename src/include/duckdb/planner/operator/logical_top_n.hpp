@@ -12,6 +12,7 @@
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
+class DynamicTableFilterSet;
 
 //! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap
 class LogicalTopN : public LogicalOperator {
@@ -28,6 +29,10 @@ public:
 	idx_t limit;
 	//! The offset from the start to begin emitting elements
 	idx_t offset;
+	//! The dynamic filters of the scan that the first ORDER BY column originates from (if any)
+	//! The boundary of the heap is pushed into this scan as a filter on "dynamic_filter_column"
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	idx_t dynamic_filter_column = DConstants::INVALID_INDEX;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6,  // bloom filter over the hashes of a set of values (e.g. the build side keys of a hash join)
+	IN_FILTER = 7,     // set membership (e.g. IN (C1, C2, C3, ...))
+	DYNAMIC_FILTER = 8 // constant comparison whose constant is updated during execution (e.g. a Top-N boundary)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
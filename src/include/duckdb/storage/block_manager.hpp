@@ -58,6 +58,9 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Hint that a range of blocks will be read soon, so their reads can be issued in the background
+	virtual void ReadAhead(block_id_t start_block, idx_t block_count) {
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
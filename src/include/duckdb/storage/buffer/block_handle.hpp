@@ -141,6 +141,12 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
+	//! The eviction sequence number at the time the block was last loaded
+	atomic<idx_t> load_seq_num;
+	//! The eviction queue that holds the latest node of this block
+	atomic<idx_t> eviction_queue_idx;
+	//! The buffer pool's count of evictions of once-used blocks when this block was evicted as such (0 if never)
+	atomic<idx_t> single_use_eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
 	//! When to destroy the data buffer
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -52,6 +53,10 @@ public:
 	void SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold);
 	idx_t GetAllocatorBulkDeallocationFlushThreshold();
 
+	//! Set the policy that decides which persistent blocks are evicted first
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
 	void UpdateUsedMemory(MemoryTag tag, int64_t size);
 
 	idx_t GetUsedMemory() const;
@@ -63,6 +68,11 @@ public:
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
 protected:
+	//! The index of the eviction queue for repeatedly used persistent blocks (TWO_QUEUE policy)
+	static constexpr idx_t FREQUENT_BLOCK_QUEUE_IDX = FILE_BUFFER_TYPE_COUNT;
+	//! The total number of eviction queues
+	static constexpr idx_t EVICTION_QUEUE_COUNT = FILE_BUFFER_TYPE_COUNT + 1;
+
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
 	//! If the "buffer" argument is specified AND the system can find a buffer to re-use for the given allocation size
@@ -88,8 +98,10 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the index of the eviction queue a block handle is added to, given its new eviction sequence number
+	idx_t GetEvictionQueueIndex(BlockHandle &handle, idx_t eviction_seq_num);
+	//! Increments the dead nodes for the queue that holds the latest node of the block handle
+	void IncrementDeadNodes(BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -143,8 +155,12 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues, one per file buffer type, followed by the queue for repeatedly used persistent blocks
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The policy that decides which persistent blocks are evicted first
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! The amount of persistent blocks that were evicted after being used only once (with the TWO_QUEUE policy)
+	atomic<idx_t> single_use_evictions;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
@@ -40,6 +40,10 @@ public:
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
+	//! Issue background reads for a series of blocks that are about to be pinned, without loading them into memory.
+	//! Note that this is a performance suggestion, by default it is ignored.
+	virtual void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	}
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
 
 	//! Returns the currently allocated memory
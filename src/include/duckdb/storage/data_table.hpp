@@ -48,6 +48,12 @@ enum class VerifyExistenceType : uint8_t;
 
 //! DataTable represents a physical table on disk
 class DataTable {
+public:
+	//! The amount of morsels per thread we aim for when a table has fewer row groups than threads
+	static constexpr const idx_t MORSELS_PER_THREAD = 4;
+	//! The minimum amount of vectors in a morsel that is smaller than a row group
+	static constexpr const idx_t MIN_MORSEL_VECTOR_COUNT = 4;
+
 public:
 	//! Constructs a new data table from an (optional) set of persistent segments
 	DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager, const string &schema,
@@ -241,6 +247,8 @@ private:
 
 	void InitializeScanWithOffset(TableScanState &state, const vector<column_t> &column_ids, idx_t start_row,
 	                              idx_t end_row);
+	//! Returns the amount of vectors that are handed out per morsel in a parallel scan of this table
+	idx_t GetMorselVectorCount(ClientContext &context);
 
 	void VerifyForeignKeyConstraint(const BoundForeignKeyConstraint &bfk, ClientContext &context, DataChunk &chunk,
 	                                VerifyExistenceType verify_type);
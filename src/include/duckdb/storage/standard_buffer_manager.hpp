@@ -69,6 +69,7 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
+	void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
@@ -152,6 +153,8 @@ protected:
 
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
 	               block_id_t first_block, block_id_t last_block);
+	//! Returns the blocks that are not loaded yet, as a map of block id -> index in the handles
+	static map<block_id_t, idx_t> GetBlocksToLoad(vector<shared_ptr<BlockHandle>> &handles);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
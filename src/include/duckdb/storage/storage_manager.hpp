@@ -36,6 +36,14 @@ public:
 	virtual void RevertCommit() = 0;
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	//! Write the commit, after which it can no longer be reverted. Storage that supports group commit defers
+	//! making the commit persistent to SyncCommit
+	virtual void WriteCommit() {
+		FlushCommit();
+	}
+	//! Make a written commit persistent, together with other commits that were written concurrently
+	virtual void SyncCommit() {
+	}
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -53,7 +53,8 @@ struct RowGroupAppendState {
 };
 
 struct IndexLock {
-	unique_lock<mutex> index_lock;
+	//! The exclusive lock on the index that is held while modifying it
+	unique_ptr<StorageLockKey> index_lock;
 };
 
 struct TableAppendState {
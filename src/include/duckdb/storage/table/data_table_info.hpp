@@ -48,6 +48,12 @@ public:
 		return checkpoint_lock.GetSharedLock();
 	}
 
+	//! Register that rows deleted by the transaction with the given commit id were removed from the indexes
+	void RegisterIndexDelete(transaction_t commit_id);
+	//! Whether the indexes might miss rows that are visible to a transaction with the given start time, because the
+	//! rows were removed from the indexes by a delete that committed after the transaction started
+	bool IndexesMissVisibleRows(transaction_t start_time) const;
+
 	string GetSchemaName();
 	string GetTableName();
 	void SetTableName(string name);
@@ -69,6 +75,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the latest delete that removed rows from the indexes while older transactions were active
+	atomic<transaction_t> last_index_delete_commit;
 };
 
 } // namespace duckdb
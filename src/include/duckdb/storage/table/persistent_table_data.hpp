@@ -9,6 +9,8 @@
 #pragma once
 
 #include "duckdb/common/constants.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
@@ -16,6 +18,7 @@
 
 namespace duckdb {
 class BaseStatistics;
+class LazyTableData;
 
 class PersistentTableData {
 public:
@@ -26,6 +29,28 @@ public:
 	idx_t total_rows;
 	idx_t row_group_count;
 	MetaBlockPointer block_pointer;
+	//! If set, the table statistics and row group pointers have not been read yet, and are read on first access
+	shared_ptr<LazyTableData> lazy_data;
+};
+
+//! The statistics and row group pointers of a table, which are read from the metadata on first access of the table
+class LazyTableData {
+public:
+	LazyTableData(MetadataManager &manager, MetaBlockPointer table_pointer, vector<LogicalType> types);
+	~LazyTableData();
+
+	//! Read the table statistics and row group pointers, if they have not been read yet
+	PersistentTableData &Load();
+
+private:
+	mutex lock;
+	MetadataManager &manager;
+	//! The pointer to the table data
+	MetaBlockPointer table_pointer;
+	//! The physical types of the columns of the table
+	vector<LogicalType> types;
+	//! The table data, after it has been read
+	unique_ptr<PersistentTableData> data;
 };
 
 } // namespace duckdb
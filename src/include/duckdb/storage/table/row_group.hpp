@@ -142,6 +142,10 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Get the compression types with which the columns of the row group are written
+	vector<CompressionType> GetCompressionTypes(RowGroupWriter &writer);
+	//! Write a single column of the row group, the columns can be written concurrently
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 	bool IsPersistent() const;
 	PersistentRowGroupData SerializeRowGroupInfo() const;
@@ -190,6 +194,8 @@ private:
 
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
+	//! Issue background reads for the on-disk blocks of the remainder of an initialized scan
+	void ReadAhead(CollectionScanState &state);
 
 	vector<MetaBlockPointer> CheckpointDeletes(MetadataManager &manager);
 
@@ -14,6 +14,7 @@
 namespace duckdb {
 struct DataTableInfo;
 class PersistentTableData;
+class LazyTableData;
 class MetadataReader;
 
 class RowGroupSegmentTree : public SegmentTree<RowGroup, true> {
@@ -30,6 +31,8 @@ protected:
 	idx_t current_row_group;
 	idx_t max_row_group;
 	unique_ptr<MetadataReader> reader;
+	//! The table data the row group pointers are read from on first access (if any)
+	shared_ptr<LazyTableData> lazy_data;
 };
 
 } // namespace duckdb
@@ -252,6 +252,8 @@ struct ParallelCollectionScanState {
 	idx_t vector_index;
 	idx_t max_row;
 	idx_t batch_index;
+	//! The amount of vectors that are handed out per morsel (at most a full row group)
+	idx_t morsel_vector_count;
 	atomic<idx_t> processed_rows;
 	mutex lock;
 };
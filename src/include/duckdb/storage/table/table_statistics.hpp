@@ -16,6 +16,7 @@
 
 namespace duckdb {
 class ColumnList;
+class LazyTableData;
 class PersistentTableData;
 class Serializer;
 class Deserializer;
@@ -54,7 +55,11 @@ public:
 	unique_ptr<TableStatisticsLock> GetLock();
 
 	void Serialize(Serializer &serializer) const;
-	void Deserialize(Deserializer &deserializer, ColumnList &columns);
+	void Deserialize(Deserializer &deserializer, const vector<LogicalType> &types);
+
+private:
+	//! Read the statistics of a lazily loaded table, if they have not been read yet. Requires the statistics lock
+	void LoadLazyStatistics();
 
 private:
 	//! The statistics lock
@@ -64,6 +69,8 @@ private:
 	//! The table sample
 	//! Sample for table
 	unique_ptr<BlockingSample> table_sample;
+	//! The table data the statistics are read from on first access (if any)
+	shared_ptr<LazyTableData> lazy_data;
 };
 
 } // namespace duckdb
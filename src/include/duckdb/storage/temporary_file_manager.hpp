@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +45,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size on disk of a single block (only used when there is a manager)
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +77,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +90,13 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the buffer to the file, or the compressed buffer if this file holds compressed blocks
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slots in this file
+	idx_t GetSlotSize() const;
+	//! Whether or not this file holds compressed blocks
+	bool IsCompressed() const;
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -104,6 +111,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of a single slot in this file - files that hold compressed blocks have smaller slots
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -132,6 +141,10 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed blocks are written to slots that are a multiple of this size
+	static constexpr const idx_t COMPRESSED_SLOT_ALIGNMENT = 32768;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -162,6 +175,8 @@ private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
+	//! Compresses the buffer (if enabled) and returns the size of the slot the buffer should be written to
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
 
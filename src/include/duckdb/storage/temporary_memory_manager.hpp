@@ -10,9 +10,12 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -24,7 +27,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -54,6 +58,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client context of the query that registered this state
+	ClientContext &context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -65,12 +71,47 @@ private:
 	atomic<idx_t> materialization_penalty;
 };
 
+//! Admission of a query by the TemporaryMemoryManager, the memory budget of the query is released when it goes
+//! out of scope
+class QueryMemoryAdmission {
+	friend class TemporaryMemoryManager;
+
+private:
+	QueryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context, idx_t budget);
+
+public:
+	~QueryMemoryAdmission();
+
+private:
+	//! The TemporaryMemoryManager that admitted the query
+	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client context of the query
+	ClientContext &context;
+	//! The memory budget with which the query was admitted
+	idx_t budget;
+};
+
+//! Memory reserved by the TemporaryMemoryStates of a query
+struct QueryMemoryInformation {
+	//! The memory limit of the query, if any
+	optional_idx memory_limit;
+	//! The sum of the reservations of the active states of the query
+	idx_t reservation = 0;
+	//! Whether the query is waiting for admission
+	bool waiting = false;
+	//! Whether the query was admitted
+	bool admitted = false;
+	//! The memory budget with which the query was admitted
+	idx_t admitted_budget = 0;
+};
+
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
 //! to concurrent states, such that their combined memory usage does not exceed the limit
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
 	friend class TemporaryMemoryState;
+	friend class QueryMemoryAdmission;
 
 public:
 	TemporaryMemoryManager();
@@ -89,17 +130,32 @@ private:
 	//! The maximum ratio of the remaining memory that we reserve per TemporaryMemoryState
 	static constexpr double MAXIMUM_FREE_MEMORY_RATIO = 2.0 / 3.0;
 
+	//! The interval (in milliseconds) at which a query waiting for admission checks whether it was interrupted
+	static constexpr idx_t ADMISSION_WAIT_INTERVAL_MS = 100;
+	//! The maximum time (in milliseconds) a query waits for admission before it fails, e.g., when it waits for a query
+	//! that is executed by the same thread
+	static constexpr idx_t MAXIMUM_ADMISSION_WAIT_MS = 60000;
+
 public:
 	//! Get the TemporaryMemoryManager
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Admit a query, waiting until its memory budget fits next to the budgets of the other admitted queries
+	//! Returns nullptr if query admission control is disabled
+	unique_ptr<QueryMemoryAdmission> AdmitQuery(ClientContext &context);
+	//! Get the memory reserved by the active queries
+	vector<QueryMemoryInformation> GetQueryMemoryInformation();
 
 private:
 	//! Locks the TemporaryMemoryManager
 	unique_lock<mutex> Lock();
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Release the budget of an admitted query (called by the destructor of QueryMemoryAdmission)
+	void Release(QueryMemoryAdmission &admission);
+	//! Remove the information on a query if it has no reservation and is not admitted (must hold the lock)
+	void CleanupQuery(ClientContext &context);
 	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
@@ -108,6 +164,8 @@ private:
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
+	//! Get the memory that a state of the query may still reserve without exceeding the query's memory limit
+	idx_t GetQueryFreeMemory(const TemporaryMemoryState &temporary_memory_state);
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Verify internal counts (must hold the lock)
@@ -132,6 +190,15 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! Memory reserved and admitted per query
+	reference_map_t<ClientContext, QueryMemoryInformation> queries;
+	//! The sum of the memory budgets of the admitted queries
+	idx_t admitted_budget;
+	//! The number of admitted queries
+	idx_t admitted_queries;
+	//! Notified when an admitted query releases its budget
+	std::condition_variable admission_cv;
 };
 
 } // namespace duckdb
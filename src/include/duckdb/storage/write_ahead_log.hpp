@@ -113,6 +113,12 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Write the flush marker of a commit and pass the WAL to the OS, without syncing it to disk.
+	//! Returns the sequence number with which SyncCommit makes the commit durable
+	idx_t WriteCommit();
+	//! Sync the WAL to disk, unless the commit with the given sequence number was already synced. All commits that
+	//! are written while a sync is in progress are synced together by the next sync (group commit)
+	void SyncCommit(idx_t commit_sequence);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +129,12 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! Serializes the syncs of commits
+	mutex sync_lock;
+	//! The sequence number of the last commit that was written to the WAL
+	atomic<idx_t> written_commits;
+	//! The sequence number of the last commit that was synced to disk
+	atomic<idx_t> synced_commits;
 };
 
 } // namespace duckdb
@@ -21,7 +21,7 @@ struct UpdateInfo;
 
 class CleanupState {
 public:
-	explicit CleanupState(transaction_t lowest_active_transaction);
+	CleanupState(transaction_t lowest_active_transaction, transaction_t commit_id);
 	~CleanupState();
 
 	// all tables with indexes that possibly need a vacuum (after e.g. a delete)
@@ -33,6 +33,8 @@ public:
 private:
 	//! Lowest active transaction
 	transaction_t lowest_active_transaction;
+	//! The commit id of the transaction that is cleaned up
+	transaction_t commit_id;
 	// data for index cleanup
 	optional_ptr<DataTable> current_table;
 	DataChunk chunk;
@@ -11,6 +11,9 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class DuckTransaction;
@@ -33,6 +36,8 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Stop the background checkpoint thread (if any), waiting for a running checkpoint to finish
+	void StopBackgroundCheckpoints();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -80,6 +85,15 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Whether automatic checkpoints are left to the background checkpoint thread - this is not the case for the first
+	//! automatic checkpoint after a failed background checkpoint
+	bool UseBackgroundCheckpoints();
+	//! Request an automatic checkpoint from the background checkpoint thread, starting it if required
+	void ScheduleBackgroundCheckpoint();
+	//! The loop of the background checkpoint thread
+	void BackgroundCheckpointThread();
+	//! Checkpoint if no write transactions are active, otherwise leave the checkpoint to a later request
+	void TryBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -109,6 +123,26 @@ private:
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
+	//! The number of commits that are committed in memory, but not yet synced to the WAL (protected by the
+	//! transaction lock). New transactions wait until they are synced, so they cannot read data that is lost on a crash
+	idx_t unsynced_commits = 0;
+	//! Notified when all unsynced commits have been synced
+	std::condition_variable commits_synced;
+
+	//! Lock for the state of the background checkpoint thread
+	mutex background_checkpoint_lock;
+	//! Notified when a background checkpoint is requested, or the background checkpoint thread is stopped
+	std::condition_variable background_checkpoint_cv;
+	//! Whether a background checkpoint was requested
+	bool background_checkpoint_requested = false;
+	//! Whether the background checkpoint thread has to stop
+	bool background_checkpoint_stopped = false;
+	//! The error of the last background checkpoint, if it failed
+	ErrorData background_checkpoint_error;
+#ifndef DUCKDB_NO_THREADS
+	//! The thread that performs automatic checkpoints in the background (if enabled)
+	unique_ptr<thread> background_checkpoint_thread;
+#endif
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
@@ -45,8 +45,8 @@ public:
 	bool ChangesMade();
 	UndoBufferProperties GetProperties();
 
-	//! Cleanup the undo buffer
-	void Cleanup(transaction_t lowest_active_transaction);
+	//! Cleanup the undo buffer of the transaction with the given commit id
+	void Cleanup(transaction_t lowest_active_transaction, transaction_t commit_id);
 	//! Commit the changes made in the UndoBuffer: should be called on commit
 	void WriteToWAL(WriteAheadLog &wal, optional_ptr<StorageCommitState> commit_state);
 	//! Commit the changes made in the UndoBuffer: should be called on commit
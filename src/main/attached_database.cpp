@@ -220,6 +220,11 @@ void AttachedDatabase::Close() {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// stop checkpointing in the background before the final checkpoint
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
+
 	if (Exception::UncaughtException()) {
 		return;
 	}
@@ -40,6 +40,7 @@
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -51,6 +52,10 @@ public:
 	string query;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
+	//! The admission of the query by the TemporaryMemoryManager (if any)
+	unique_ptr<QueryMemoryAdmission> memory_admission;
+	//! The plan of a query that is admitted when its execution starts, it is not initialized in the executor until then
+	unique_ptr<PhysicalOperator> admission_plan;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
@@ -301,6 +306,9 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
+		// the client can keep a streaming result open indefinitely - release its memory budget, so it does not keep
+		// other queries from being admitted
+		active_query->memory_admission.reset();
 		active_query->SetOpenResult(*result);
 	}
 	return result;
@@ -476,6 +484,21 @@ void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &
 	}
 }
 
+//! Whether a statement can use a lot of memory, and has to wait for admission before it starts
+static bool RequiresMemoryAdmission(StatementType statement_type) {
+	switch (statement_type) {
+	case StatementType::SELECT_STATEMENT:
+	case StatementType::INSERT_STATEMENT:
+	case StatementType::UPDATE_STATEMENT:
+	case StatementType::DELETE_STATEMENT:
+	case StatementType::CREATE_STATEMENT:
+	case StatementType::COPY_STATEMENT:
+		return true;
+	default:
+		return false;
+	}
+}
+
 unique_ptr<PendingQueryResult>
 ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
                                                 const PendingQueryParameters &parameters) {
@@ -508,10 +531,15 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 	statement.is_streaming = stream_result;
 	auto collector = get_method(*this, statement);
 	D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
-	executor.Initialize(std::move(collector));
-
-	auto types = executor.GetTypes();
+	auto types = collector->GetTypes();
 	D_ASSERT(types == statement.types);
+	if (RequiresMemoryAdmission(statement.statement_type) && DBConfig::GetConfig(*this).options.query_admission_control) {
+		// the query waits for admission when its execution starts, a pending query that is not executed (yet) does
+		// not keep other queries from being admitted
+		active_query->admission_plan = std::move(collector);
+	} else {
+		executor.Initialize(std::move(collector));
+	}
 	D_ASSERT(!active_query->HasOpenResult());
 
 	auto pending_result =
@@ -554,6 +582,11 @@ PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &loc
 	D_ASSERT(active_query->IsOpenResult(result));
 	bool invalidate_transaction = true;
 	try {
+		if (active_query->admission_plan) {
+			// wait for admission before the tasks of the query are scheduled
+			active_query->memory_admission = TemporaryMemoryManager::Get(*this).AdmitQuery(*this);
+			active_query->executor->Initialize(std::move(active_query->admission_plan));
+		}
 		auto query_result = active_query->executor->ExecuteTask(dry_run);
 		if (active_query->progress_bar) {
 			auto is_finished = PendingQueryResult::IsResultReady(query_result);
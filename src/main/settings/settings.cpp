@@ -95,6 +95,22 @@ Value CatalogErrorMaxSchema::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -1085,6 +1101,21 @@ Value ForceBitpackingModeSetting::GetSetting(const ClientContext &context) {
 	return Value(BitpackingModeToString(context.db->config.options.force_bitpacking_mode));
 }
 
+//===--------------------------------------------------------------------===//
+// ZSTD Min String Length
+//===--------------------------------------------------------------------===//
+void ZSTDMinStringLengthSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.zstd_min_string_length = input.GetValue<uint64_t>();
+}
+
+void ZSTDMinStringLengthSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.zstd_min_string_length = DBConfig().options.zstd_min_string_length;
+}
+
+Value ZSTDMinStringLengthSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(context.db->config.options.zstd_min_string_length);
+}
+
 //===--------------------------------------------------------------------===//
 // Home Directory
 //===--------------------------------------------------------------------===//
@@ -1299,6 +1330,47 @@ Value StreamingBufferSize::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.streaming_buffer_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == NumericLimits<idx_t>::Maximum()) {
+		config.query_memory_limit = optional_idx();
+	} else {
+		config.query_memory_limit = limit;
+	}
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.query_memory_limit.IsValid()) {
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit.GetIndex()));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Admission Control
+//===--------------------------------------------------------------------===//
+void QueryAdmissionControlSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_admission_control = input.GetValue<bool>();
+}
+
+void QueryAdmissionControlSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_admission_control = DBConfig().options.query_admission_control;
+}
+
+Value QueryAdmissionControlSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.query_admission_control);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Temp Directory Size
 //===--------------------------------------------------------------------===//
@@ -1344,6 +1416,22 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Vacuum Size
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2062,84 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else if (parameter == "on" || parameter == "true") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (parameter == "off" || parameter == "false") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else {
+		throw InvalidInputException("Unrecognized parameter for option PIN_THREADS \"%s\". Expected AUTO, ON or OFF.",
+		                            parameter);
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinMode(config.options.pin_threads);
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinMode(config.options.pin_threads);
+	}
+}
+
+Value PinThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.pin_threads) {
+	case ThreadPinMode::AUTO:
+		return "auto";
+	case ThreadPinMode::ON:
+		return "on";
+	case ThreadPinMode::OFF:
+		return "off";
+	default:
+		throw InternalException("Unknown thread pin mode setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", parameter);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -300,6 +300,15 @@ void CompressedMaterialization::CreateDecompressProjection(unique_ptr<LogicalOpe
 	replacer.VisitOperator(*root);
 }
 
+static bool IsCompressibleTemporal(const LogicalType &type) {
+	for (const auto &temporal_type : CompressedMaterializationFunctions::TemporalTypes()) {
+		if (type == temporal_type) {
+			return true;
+		}
+	}
+	return false;
+}
+
 unique_ptr<CompressExpression> CompressedMaterialization::GetCompressExpression(const ColumnBinding &binding,
                                                                                 const LogicalType &type,
                                                                                 const bool &can_compress) {
@@ -318,7 +327,7 @@ unique_ptr<CompressExpression> CompressedMaterialization::GetCompressExpression(
 	if (type != stats.GetType()) { // LCOV_EXCL_START
 		return nullptr;
 	} // LCOV_EXCL_STOP
-	if (type.IsIntegral()) {
+	if (type.IsIntegral() || IsCompressibleTemporal(type)) {
 		return GetIntegralCompress(std::move(input), stats);
 	} else if (type.id() == LogicalTypeId::VARCHAR) {
 		return GetStringCompress(std::move(input), stats);
@@ -326,9 +335,27 @@ unique_ptr<CompressExpression> CompressedMaterialization::GetCompressExpression(
 	return nullptr;
 }
 
-static Value GetIntegralRangeValue(ClientContext &context, const LogicalType &type, const BaseStatistics &stats) {
+static Value GetPhysicalValue(const Value &value) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT32:
+		return Value::INTEGER(value.GetValueUnsafe<int32_t>());
+	case PhysicalType::INT64:
+		return Value::BIGINT(value.GetValueUnsafe<int64_t>());
+	default:
+		throw InternalException("Unexpected physical type in GetPhysicalValue");
+	}
+}
+
+static Value GetIntegralRangeValue(ClientContext &context, const LogicalType &type_p, const BaseStatistics &stats) {
 	auto min = NumericStats::Min(stats);
 	auto max = NumericStats::Max(stats);
+	auto type = type_p;
+	if (IsCompressibleTemporal(type)) {
+		// Temporal types are compressed like their physical (integral) representation
+		min = GetPhysicalValue(min);
+		max = GetPhysicalValue(max);
+		type = min.type();
+	}
 
 	vector<unique_ptr<Expression>> arguments;
 	arguments.emplace_back(make_uniq<BoundConstantExpression>(max));
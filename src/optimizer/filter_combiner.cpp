@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -582,9 +583,11 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 			}
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
+			if (!type.IsNumeric() && type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BOOLEAN) {
+				continue;
+			}
 
-			if ((type.IsNumeric() || type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BOOLEAN) &&
-			    func.children.size() == 2) {
+			if (func.children.size() == 2) {
 				auto bound_eq_comparison =
 				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, fst_const_value_expr.value);
 				table_filters.PushFilter(column_index, std::move(bound_eq_comparison));
@@ -595,37 +598,46 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(const vector<idx_t> &col
 
 			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
 			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
-				continue;
-			}
-
-			for (idx_t i = 1; i < func.children.size(); i++) {
-				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
-				D_ASSERT(!const_value_expr.value.IsNull());
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
-			}
-			if (in_values.empty()) {
-				continue;
-			}
+			if (type.IsIntegral()) {
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					D_ASSERT(!const_value_expr.value.IsNull());
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+				sort(in_values.begin(), in_values.end());
 
-			sort(in_values.begin(), in_values.end());
+				bool can_simplify_in_clause = true;
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
+				}
+				if (can_simplify_in_clause) {
+					auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+					                                             Value::Numeric(type, in_values.front()));
+					auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
+					                                             Value::Numeric(type, in_values.back()));
+					table_filters.PushFilter(column_index, std::move(lower_bound));
+					table_filters.PushFilter(column_index, std::move(upper_bound));
+					table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 
-			bool can_simplify_in_clause = true;
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+					remaining_filters.erase_at(rem_fil_idx);
+					continue;
 				}
 			}
-			if (!can_simplify_in_clause) {
+
+			//! Otherwise we push the set of values as an IN filter
+			// this allows the scan to prune row groups using the min/max of the set, instead of scanning everything
+			// and evaluating the IN clause (or the mark join it is rewritten into) afterwards
+			if (!InFilter::SupportsType(type)) {
 				continue;
 			}
-			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.front()));
-			auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.back()));
-			table_filters.PushFilter(column_index, std::move(lower_bound));
-			table_filters.PushFilter(column_index, std::move(upper_bound));
+			vector<Value> values;
+			for (idx_t i = 1; i < func.children.size(); i++) {
+				values.push_back(func.children[i]->Cast<BoundConstantExpression>().value);
+			}
+			table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(values)));
 			table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 
 			remaining_filters.erase_at(rem_fil_idx);
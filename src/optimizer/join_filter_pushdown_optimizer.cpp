@@ -1,7 +1,9 @@
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_delim_get.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
@@ -15,6 +17,133 @@ namespace duckdb {
 JoinFilterPushdownOptimizer::JoinFilterPushdownOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
 }
 
+//! Finds the LogicalGet that the probe columns of the filters originate from (if any)
+//! The probe column bindings of the filters are rewritten to refer to the columns of the LogicalGet
+//! If "through_row_selection" is false, we do not pass through operators that select rows based on their position
+//! or order (e.g. LIMIT), since removing other rows below them changes which rows they select
+static optional_ptr<LogicalGet> FindPushdownTarget(LogicalOperator &op, vector<JoinFilterPushdownColumn> &filters,
+                                                   bool through_row_selection = true) {
+	reference<LogicalOperator> probe_source(op);
+	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &probe_child = probe_source.get();
+		switch (probe_child.type) {
+		case LogicalOperatorType::LOGICAL_LIMIT:
+		case LogicalOperatorType::LOGICAL_TOP_N:
+		case LogicalOperatorType::LOGICAL_DISTINCT:
+			if (!through_row_selection) {
+				return nullptr;
+			}
+			probe_source = *probe_child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_FILTER:
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+			// does not affect probe side - continue into left child
+			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
+			probe_source = *probe_child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			// projection - check if we all of the expressions are only column references
+			auto &proj = probe_source.get().Cast<LogicalProjection>();
+			for (auto &filter : filters) {
+				if (filter.probe_column_index.table_index != proj.table_index) {
+					// index does not belong to this projection - bail-out
+					return nullptr;
+				}
+				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
+				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+					// not a simple column ref - bail-out
+					return nullptr;
+				}
+				// column-ref - pass through the new column binding
+				auto &colref = expr.Cast<BoundColumnRefExpression>();
+				filter.probe_column_index = colref.binding;
+			}
+			probe_source = *probe_child.children[0];
+			break;
+		}
+		default:
+			// unsupported child type
+			return nullptr;
+		}
+	}
+	// found the LogicalGet
+	auto &get = probe_source.get().Cast<LogicalGet>();
+	if (!get.function.filter_pushdown) {
+		// filter pushdown is not supported - bail-out
+		return nullptr;
+	}
+	for (auto &filter : filters) {
+		if (filter.probe_column_index.table_index != get.table_index) {
+			// the filter does not apply to the probe side here - bail-out
+			return nullptr;
+		}
+	}
+	return &get;
+}
+
+//! Finds the LogicalDelimGet that the column "binding" originates from (if any)
+//! The binding is rewritten to refer to the column of the LogicalDelimGet
+static optional_ptr<LogicalDelimGet> FindDelimGet(LogicalOperator &op, ColumnBinding &binding) {
+	reference<LogicalOperator> source(op);
+	while (source.get().type != LogicalOperatorType::LOGICAL_DELIM_GET) {
+		auto &child = source.get();
+		switch (child.type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// filters only remove values - continue into the child
+			source = *child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+			// joins do not introduce new values (other than NULL) - continue into the side the column comes from
+			auto left_bindings = child.children[0]->GetColumnBindings();
+			bool from_left = std::find(left_bindings.begin(), left_bindings.end(), binding) != left_bindings.end();
+			source = *child.children[from_left ? 0 : 1];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return nullptr;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return nullptr;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			source = *child.children[0];
+			break;
+		}
+		default:
+			return nullptr;
+		}
+	}
+	auto &delim_get = source.get().Cast<LogicalDelimGet>();
+	if (binding.table_index != delim_get.table_index) {
+		return nullptr;
+	}
+	return &delim_get;
+}
+
+//! Collects the table indexes of the duplicate eliminated scans on the delim side "op" of a delim join
+//! The delim sides of nested delim joins are skipped: their duplicate eliminated scans belong to the nested delim join
+static void CollectDelimGets(LogicalOperator &op, vector<idx_t> &table_indexes) {
+	if (op.type == LogicalOperatorType::LOGICAL_DELIM_GET) {
+		table_indexes.push_back(op.Cast<LogicalDelimGet>().table_index);
+		return;
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_DELIM_JOIN) {
+		auto &nested_join = op.Cast<LogicalComparisonJoin>();
+		const idx_t delim_idx = nested_join.delim_flipped ? 0 : 1;
+		CollectDelimGets(*op.children[1 - delim_idx], table_indexes);
+		return;
+	}
+	for (auto &child : op.children) {
+		CollectDelimGets(*child, table_indexes);
+	}
+}
+
 void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
 	switch (join.join_type) {
 	case JoinType::MARK:
@@ -22,12 +151,11 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 	case JoinType::LEFT:
 	case JoinType::OUTER:
 	case JoinType::ANTI:
-	case JoinType::RIGHT_ANTI:
-	case JoinType::RIGHT_SEMI:
 		// cannot generate join filters for these join types
 		// mark/single - cannot change cardinality of probe side
 		// left/outer always need to include every row from probe side
-		// FIXME: anti/right_anti - we could do this, but need to invert the join conditions
+		// anti - needs every probe side row that does NOT match
+		// note that right_semi/right_anti are fine: probe side rows without a match never affect their result
 		return;
 	default:
 		break;
@@ -65,92 +193,189 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		return;
 	}
 	// find the child LogicalGet (if possible)
-	reference<LogicalOperator> probe_source(*join.children[0]);
-	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
-		auto &probe_child = probe_source.get();
-		switch (probe_child.type) {
-		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
-		case LogicalOperatorType::LOGICAL_TOP_N:
-		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
-			// does not affect probe side - continue into left child
-			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
-			probe_source = *probe_child.children[0];
-			break;
-		case LogicalOperatorType::LOGICAL_PROJECTION: {
-			// projection - check if we all of the expressions are only column references
-			auto &proj = probe_source.get().Cast<LogicalProjection>();
-			for (auto &filter : pushdown_info->filters) {
-				if (filter.probe_column_index.table_index != proj.table_index) {
-					// index does not belong to this projection - bail-out
-					return;
-				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
-					// not a simple column ref - bail-out
-					return;
-				}
-				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
-				filter.probe_column_index = colref.binding;
-			}
-			probe_source = *probe_child.children[0];
-			break;
+	auto get = FindPushdownTarget(*join.children[0], pushdown_info->filters);
+	if (!get) {
+		return;
+	}
+	// pushdown can be performed
+
+	// set up the min/max aggregates for each of the filters
+	vector<unique_ptr<Expression>> build_expressions;
+	for (auto &filter : pushdown_info->filters) {
+		build_expressions.push_back(join.conditions[filter.join_condition].right->Copy());
+	}
+	if (!GenerateMinMaxAggregates(*pushdown_info, std::move(build_expressions))) {
+		return;
+	}
+	SetDynamicFilters(*get, *pushdown_info);
+
+	// set up the filter pushdown in the join itself
+	join.filter_pushdown = std::move(pushdown_info);
+}
+
+void JoinFilterPushdownOptimizer::GenerateDelimJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT_SEMI:
+		break;
+	default:
+		// we can only filter the build side if build side rows without a match never affect the result
+		return;
+	}
+	// the duplicate eliminated columns of a delim join are available before its delim side is executed
+	// if the probe side reads them, we can filter the build side on the duplicate eliminated values
+	optional_ptr<LogicalComparisonJoin> delim_join;
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	vector<unique_ptr<Expression>> delim_expressions;
+	for (auto &cond : join.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
 		}
-		default:
-			// unsupported child type
-			return;
+		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF || cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		if (cond.right->return_type.IsNested() || cond.right->return_type.id() == LogicalTypeId::INTERVAL) {
+			continue;
+		}
+		auto delim_binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+		auto delim_get = FindDelimGet(*join.children[0], delim_binding);
+		if (!delim_get) {
+			continue;
+		}
+		auto entry = delim_gets.find(delim_get->table_index);
+		if (entry == delim_gets.end()) {
+			// not a duplicate eliminated scan of a delim join whose delim side we are visiting
+			continue;
 		}
+		if (delim_join && delim_join.get() != &entry->second.get()) {
+			// the filters of a join are generated by a single delim join
+			continue;
+		}
+		delim_join = entry->second.get();
+		D_ASSERT(delim_binding.column_index < delim_join->duplicate_eliminated_columns.size());
+		auto &delim_column = *delim_join->duplicate_eliminated_columns[delim_binding.column_index];
+		if (delim_column.return_type != cond.right->return_type) {
+			continue;
+		}
+		JoinFilterPushdownColumn pushdown_col;
+		// for delim joins, the "join condition" is the index of the duplicate eliminated column
+		pushdown_col.join_condition = delim_binding.column_index;
+		pushdown_col.probe_column_index = cond.right->Cast<BoundColumnRefExpression>().binding;
+		pushdown_info->filters.push_back(pushdown_col);
+		delim_expressions.push_back(delim_column.Copy());
 	}
-	// found the LogicalGet
-	auto &get = probe_source.get().Cast<LogicalGet>();
-	if (!get.function.filter_pushdown) {
-		// filter pushdown is not supported - bail-out
+	if (pushdown_info->filters.empty()) {
 		return;
 	}
-	for (auto &filter : pushdown_info->filters) {
-		if (filter.probe_column_index.table_index != get.table_index) {
-			// the filter does not apply to the probe side here - bail-out
-			return;
-		}
+	// find the LogicalGet on the build side (if possible)
+	auto get = FindPushdownTarget(*join.children[1], pushdown_info->filters);
+	if (!get) {
+		return;
 	}
-	// pushdown can be performed
+	if (!GenerateMinMaxAggregates(*pushdown_info, std::move(delim_expressions))) {
+		return;
+	}
+	SetDynamicFilters(*get, *pushdown_info);
 
-	// set up the min/max aggregates for each of the filters
+	// the filters are generated by the delim join
+	delim_join->delim_filter_pushdown.push_back(std::move(pushdown_info));
+}
+
+bool JoinFilterPushdownOptimizer::GenerateMinMaxAggregates(JoinFilterPushdownInfo &pushdown_info,
+                                                           vector<unique_ptr<Expression>> build_expressions) {
+	D_ASSERT(build_expressions.size() == pushdown_info.filters.size());
 	vector<AggregateFunction> aggr_functions;
 	aggr_functions.push_back(MinFun::GetFunction());
 	aggr_functions.push_back(MaxFun::GetFunction());
-	for (auto &filter : pushdown_info->filters) {
+	for (auto &build_expr : build_expressions) {
 		for (auto &aggr : aggr_functions) {
 			FunctionBinder function_binder(optimizer.GetContext());
 			vector<unique_ptr<Expression>> aggr_children;
-			aggr_children.push_back(join.conditions[filter.join_condition].right->Copy());
+			aggr_children.push_back(build_expr->Copy());
 			auto aggr_expr = function_binder.BindAggregateFunction(aggr, std::move(aggr_children), nullptr,
 			                                                       AggregateType::NON_DISTINCT);
 			if (aggr_expr->children.size() != 1) {
 				// min/max with collation - not supported
-				return;
+				return false;
 			}
-			pushdown_info->min_max_aggregates.push_back(std::move(aggr_expr));
+			pushdown_info.min_max_aggregates.push_back(std::move(aggr_expr));
 		}
 	}
+	return true;
+}
+
+void JoinFilterPushdownOptimizer::SetDynamicFilters(LogicalGet &get, JoinFilterPushdownInfo &pushdown_info) {
 	// set up the dynamic filters (if we don't have any yet)
 	if (!get.dynamic_filters) {
 		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 	}
-	pushdown_info->dynamic_filters = get.dynamic_filters;
+	pushdown_info.dynamic_filters = get.dynamic_filters;
+}
 
-	// set up the filter pushdown in the join itself
-	join.filter_pushdown = std::move(pushdown_info);
+void JoinFilterPushdownOptimizer::GenerateTopNFilters(LogicalTopN &top_n) {
+	auto &order = top_n.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values come first - the rows that are not filtered out would have to include NULL values
+		return;
+	}
+	auto &expr = *order.expression;
+	if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+		// only bound column ref supported for now
+		return;
+	}
+	if (expr.return_type.IsNested() || expr.return_type.id() == LogicalTypeId::INTERVAL) {
+		// nested columns and intervals are not supported for pushdown
+		return;
+	}
+	vector<JoinFilterPushdownColumn> filters;
+	JoinFilterPushdownColumn pushdown_col;
+	pushdown_col.join_condition = 0;
+	pushdown_col.probe_column_index = expr.Cast<BoundColumnRefExpression>().binding;
+	filters.push_back(pushdown_col);
+
+	// find the LogicalGet that the ORDER BY column originates from (if possible)
+	auto get = FindPushdownTarget(*top_n.children[0], filters, false);
+	if (!get) {
+		return;
+	}
+	if (!get->dynamic_filters) {
+		get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	// the Top-N pushes the boundary of its heap into the scan while it is running
+	top_n.dynamic_filters = get->dynamic_filters;
+	top_n.dynamic_filter_column = filters[0].probe_column_index.column_index;
 }
 
 void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
 		// comparison join - try to generate join filters (if possible)
-		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		GenerateJoinFilters(join);
+		if (!delim_gets.empty()) {
+			GenerateDelimJoinFilters(join);
+		}
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+		// Top-N - try to push the boundary of the heap into the scan (if possible)
+		GenerateTopNFilters(op.Cast<LogicalTopN>());
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_DELIM_JOIN) {
+		// delim join - any duplicate eliminated scans on the delim side belong to this delim join
+		auto &delim_join = op.Cast<LogicalComparisonJoin>();
+		const idx_t delim_idx = delim_join.delim_flipped ? 0 : 1;
+		VisitOperatorExpressions(op);
+		VisitOperator(*op.children[1 - delim_idx]);
+		vector<idx_t> delim_get_indexes;
+		CollectDelimGets(*op.children[delim_idx], delim_get_indexes);
+		for (auto &table_index : delim_get_indexes) {
+			delim_gets.emplace(table_index, delim_join);
+		}
+		VisitOperator(*op.children[delim_idx]);
+		for (auto &table_index : delim_get_indexes) {
+			delim_gets.erase(table_index);
+		}
+		return;
 	}
 	LogicalOperatorVisitor::VisitOperator(op);
 }
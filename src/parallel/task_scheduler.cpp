@@ -23,6 +23,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && defined(_GNU_SOURCE) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#define DUCKDB_THREAD_AFFINITY
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -117,11 +122,27 @@ ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerT
 ProducerToken::~ProducerToken() {
 }
 
+static vector<idx_t> GetAvailableCPUs() {
+	vector<idx_t> result;
+#ifdef DUCKDB_THREAD_AFFINITY
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set) == 0) {
+		for (idx_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &cpu_set)) {
+				result.push_back(cpu);
+			}
+		}
+	}
+#endif
+	return result;
+}
+
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), thread_pin_mode(db.config.options.pin_threads), available_cpus(GetAvailableCPUs()) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -162,6 +183,9 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	// with a consumer token, the worker threads spread out over the producers (i.e., the executors), instead of all
+	// threads contending for the tasks of the same producer. When its producer is empty, the thread moves on to others
+	duckdb_moodycamel::ConsumerToken consumer_token(queue->q);
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush()) {
@@ -185,7 +209,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->q.try_dequeue(consumer_token, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -310,6 +334,47 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetThreadPinMode(ThreadPinMode mode) {
+	lock_guard<mutex> t(thread_lock);
+	thread_pin_mode = mode;
+	const auto pin = PinThreads();
+	for (idx_t thread_idx = 0; thread_idx < threads.size(); thread_idx++) {
+		PinThread(thread_idx, pin);
+	}
+}
+
+bool TaskScheduler::PinThreads() const {
+	switch (thread_pin_mode) {
+	case ThreadPinMode::ON:
+		return !available_cpus.empty();
+	case ThreadPinMode::AUTO:
+		return available_cpus.size() > THREAD_PIN_THRESHOLD;
+	default:
+		return false;
+	}
+}
+
+void TaskScheduler::PinThread(idx_t thread_idx, bool pin) {
+#ifdef DUCKDB_THREAD_AFFINITY
+	if (available_cpus.empty()) {
+		return;
+	}
+	// workers are pinned to consecutive CPUs, so that (if there are fewer threads than CPUs) they share NUMA nodes,
+	// and the memory that they allocate and touch first is local to them
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	if (pin) {
+		CPU_SET(available_cpus[thread_idx % available_cpus.size()], &cpu_set);
+	} else {
+		for (auto &cpu : available_cpus) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// this is best-effort: if it fails, the thread simply is not pinned
+	pthread_setaffinity_np(threads[thread_idx]->internal_thread->native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -397,6 +462,9 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
+			if (PinThreads()) {
+				PinThread(threads.size() - 1, true);
+			}
 		}
 	}
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
@@ -0,0 +1,116 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+static idx_t BloomFilterBlockCount(idx_t expected_count) {
+	return NextPowerOfTwo(MaxValue<idx_t>(expected_count * BlockedBloomFilter::BITS_PER_VALUE / 64, 1));
+}
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count) : blocks(BloomFilterBlockCount(expected_count), 0) {
+	block_mask = blocks.size() - 1;
+}
+
+BlockedBloomFilter::BlockedBloomFilter(vector<uint64_t> blocks_p) : blocks(std::move(blocks_p)) {
+	if (blocks.empty() || !IsPowerOfTwo(blocks.size())) {
+		throw SerializationException("Bloom filter block count must be a power of two");
+	}
+	block_mask = blocks.size() - 1;
+}
+
+idx_t BlockedBloomFilter::SizeInBytes(idx_t expected_count) {
+	return BloomFilterBlockCount(expected_count) * sizeof(uint64_t);
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, idx_t count, bool parallel) {
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	if (parallel) {
+		// other threads are inserting concurrently
+		auto atomic_blocks = reinterpret_cast<atomic<uint64_t> *>(blocks.data());
+		for (idx_t i = 0; i < count; i++) {
+			const auto hash = hash_data[i];
+			atomic_blocks[GetBlockIndex(hash)].fetch_or(GetMask(hash), std::memory_order_relaxed);
+		}
+	} else {
+		for (idx_t i = 0; i < count; i++) {
+			const auto hash = hash_data[i];
+			blocks[GetBlockIndex(hash)] |= GetMask(hash);
+		}
+	}
+}
+
+idx_t BlockedBloomFilter::Filter(Vector &input, SelectionVector &sel, idx_t approved_tuple_count,
+                                 idx_t scan_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// hash only the rows that are still selected
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(scan_count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto hash_idx = hdata.sel->get_index(idx);
+		bool found = vdata.validity.RowIsValid(vdata.sel->get_index(idx)) && Lookup(hash_data[hash_idx]);
+		result_sel.set_index(result_count, idx);
+		result_count += found;
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> bloom_filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), bloom_filter(std::move(bloom_filter_p)) {
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the bloom filter contains hashes - we cannot prune using min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.bloom_filter.get() == bloom_filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	// the bloom filter itself is immutable - so we can share it between copies
+	return make_uniq<BloomFilter>(bloom_filter);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the bloom filter only ever removes rows that can never match - a constant TRUE is a valid (but weaker) filter
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty<vector<uint64_t>>(200, "blocks", bloom_filter->GetBlocks());
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto blocks = deserializer.ReadProperty<vector<uint64_t>>(200, "blocks");
+	return make_uniq<BloomFilter>(make_shared_ptr<BlockedBloomFilter>(std::move(blocks)));
+}
+
+} // namespace duckdb
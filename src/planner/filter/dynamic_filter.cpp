@@ -0,0 +1,102 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p) : comparison_type(comparison_type_p) {
+	D_ASSERT(comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+	         comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO);
+}
+
+void DynamicFilterData::Update(const Value &value) {
+	if (value.IsNull()) {
+		// a NULL constant does not filter out anything
+		return;
+	}
+	lock_guard<mutex> l(lock);
+	if (filter) {
+		// only replace the constant if the new constant is more selective
+		auto &current = filter->constant;
+		bool more_selective = comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ? value > current
+		                                                                                       : value < current;
+		if (!more_selective) {
+			return;
+		}
+	}
+	filter = make_uniq<ConstantFilter>(comparison_type, value);
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	filter.reset();
+}
+
+unique_ptr<ConstantFilter> DynamicFilterData::GetFilter() const {
+	lock_guard<mutex> l(lock);
+	if (!filter) {
+		return nullptr;
+	}
+	return make_uniq<ConstantFilter>(filter->comparison_type, filter->constant);
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		// no constant has been set yet
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// note that the constant only ever becomes more selective
+	// if the filter is always true for the current constant, skipping it only means we filter out fewer rows
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return column_name + " DYNAMIC_FILTER";
+	}
+	return filter->ToString(column_name) + " DYNAMIC_FILTER";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// copies share the filter data, so they observe updates of the constant
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the dynamic filter only ever removes rows that cannot be part of the result - a constant TRUE is a valid (but
+	// weaker) filter
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty<ExpressionType>(200, "comparison_type", filter_data->comparison_type);
+	auto filter = filter_data->GetFilter();
+	serializer.WriteProperty<Value>(201, "constant", filter ? filter->constant : Value());
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(Deserializer &deserializer) {
+	auto comparison_type = deserializer.ReadProperty<ExpressionType>(200, "comparison_type");
+	auto constant = deserializer.ReadProperty<Value>(201, "constant");
+	auto filter_data = make_shared_ptr<DynamicFilterData>(comparison_type);
+	filter_data->Update(constant);
+	return make_uniq<DynamicFilter>(std::move(filter_data));
+}
+
+} // namespace duckdb
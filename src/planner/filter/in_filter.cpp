@@ -0,0 +1,274 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+template <class T>
+struct InFilterLessThan {
+	bool operator()(const T &left, const T &right) const {
+		return LessThan::Operation<T>(left, right);
+	}
+};
+
+template <class T>
+static idx_t TemplatedSortValues(Vector &sorted_values, idx_t count) {
+	auto data = FlatVector::GetData<T>(sorted_values);
+	std::sort(data, data + count, InFilterLessThan<T>());
+	idx_t distinct_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (distinct_count > 0 && Equals::Operation<T>(data[distinct_count - 1], data[i])) {
+			continue;
+		}
+		data[distinct_count++] = data[i];
+	}
+	return distinct_count;
+}
+
+static idx_t SortValues(Vector &sorted_values, idx_t count) {
+	switch (sorted_values.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedSortValues<bool>(sorted_values, count);
+	case PhysicalType::UINT8:
+		return TemplatedSortValues<uint8_t>(sorted_values, count);
+	case PhysicalType::UINT16:
+		return TemplatedSortValues<uint16_t>(sorted_values, count);
+	case PhysicalType::UINT32:
+		return TemplatedSortValues<uint32_t>(sorted_values, count);
+	case PhysicalType::UINT64:
+		return TemplatedSortValues<uint64_t>(sorted_values, count);
+	case PhysicalType::UINT128:
+		return TemplatedSortValues<uhugeint_t>(sorted_values, count);
+	case PhysicalType::INT8:
+		return TemplatedSortValues<int8_t>(sorted_values, count);
+	case PhysicalType::INT16:
+		return TemplatedSortValues<int16_t>(sorted_values, count);
+	case PhysicalType::INT32:
+		return TemplatedSortValues<int32_t>(sorted_values, count);
+	case PhysicalType::INT64:
+		return TemplatedSortValues<int64_t>(sorted_values, count);
+	case PhysicalType::INT128:
+		return TemplatedSortValues<hugeint_t>(sorted_values, count);
+	case PhysicalType::FLOAT:
+		return TemplatedSortValues<float>(sorted_values, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedSortValues<double>(sorted_values, count);
+	case PhysicalType::VARCHAR:
+		return TemplatedSortValues<string_t>(sorted_values, count);
+	default:
+		throw InternalException("Unsupported type for InFilter");
+	}
+}
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	auto &type = values[0].type();
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL - use IsNullFilter instead");
+		}
+		D_ASSERT(value.type() == type);
+	}
+	// sort and de-duplicate the values according to the physical comparison of the type
+	// this ensures the binary search in Filter/CheckStatistics agrees with the order of the values
+	sorted_values = make_uniq<Vector>(type, values.size());
+	for (idx_t i = 0; i < values.size(); i++) {
+		sorted_values->SetValue(i, values[i]);
+	}
+	auto distinct_count = SortValues(*sorted_values, values.size());
+	values.clear();
+	for (idx_t i = 0; i < distinct_count; i++) {
+		values.push_back(sorted_values->GetValue(i));
+	}
+	if (values.size() >= BLOOM_FILTER_THRESHOLD) {
+		Vector hashes(LogicalType::HASH, values.size());
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < values.size(); i++) {
+			hash_data[i] = values[i].Hash();
+		}
+		bloom_filter = make_shared_ptr<BlockedBloomFilter>(values.size());
+		bloom_filter->Insert(hashes, values.size(), false);
+	}
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	auto physical_type = type.InternalType();
+	return TypeIsNumeric(physical_type) || physical_type == PhysicalType::VARCHAR ||
+	       physical_type == PhysicalType::BOOL;
+}
+
+template <class T>
+static idx_t TemplatedInFilterSelection(UnifiedVectorFormat &vdata, const Vector &sorted_values, idx_t value_count,
+                                        SelectionVector &sel, idx_t approved_tuple_count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto begin = FlatVector::GetData<T>(sorted_values);
+	auto end = begin + value_count;
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto entry = std::lower_bound(begin, end, data[vector_idx], InFilterLessThan<T>());
+		bool found = entry != end && Equals::Operation<T>(*entry, data[vector_idx]);
+		result_sel.set_index(result_count, idx);
+		result_count += found;
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+idx_t InFilter::Filter(Vector &input, SelectionVector &sel, idx_t approved_tuple_count, idx_t scan_count) const {
+	if (bloom_filter) {
+		// large set: first discard the rows that are definitely not in the set
+		approved_tuple_count = bloom_filter->Filter(input, sel, approved_tuple_count, scan_count);
+	}
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(scan_count, vdata);
+	auto &sorted = *sorted_values;
+	auto count = values.size();
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedInFilterSelection<bool>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::UINT8:
+		return TemplatedInFilterSelection<uint8_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::UINT16:
+		return TemplatedInFilterSelection<uint16_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::UINT32:
+		return TemplatedInFilterSelection<uint32_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::UINT64:
+		return TemplatedInFilterSelection<uint64_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::UINT128:
+		return TemplatedInFilterSelection<uhugeint_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::INT8:
+		return TemplatedInFilterSelection<int8_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::INT16:
+		return TemplatedInFilterSelection<int16_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::INT32:
+		return TemplatedInFilterSelection<int32_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::INT64:
+		return TemplatedInFilterSelection<int64_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::INT128:
+		return TemplatedInFilterSelection<hugeint_t>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::FLOAT:
+		return TemplatedInFilterSelection<float>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::DOUBLE:
+		return TemplatedInFilterSelection<double>(vdata, sorted, count, sel, approved_tuple_count);
+	case PhysicalType::VARCHAR:
+		return TemplatedInFilterSelection<string_t>(vdata, sorted, count, sel, approved_tuple_count);
+	default:
+		throw InvalidTypeException(input.GetType(), "Invalid type for IN filter pushed down to table");
+	}
+}
+
+template <class T>
+static FilterPropagateResult TemplatedCheckStatistics(BaseStatistics &stats, const Vector &sorted_values,
+                                                      idx_t value_count) {
+	if (!NumericStats::HasMinMax(stats)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto min = NumericStats::GetMin<T>(stats);
+	auto max = NumericStats::GetMax<T>(stats);
+	// find the smallest value in the set that is >= min - if it is > max no value of the set is in [min, max]
+	auto begin = FlatVector::GetData<T>(sorted_values);
+	auto end = begin + value_count;
+	auto entry = std::lower_bound(begin, end, min, InFilterLessThan<T>());
+	if (entry == end || LessThan::Operation<T>(max, *entry)) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	auto &sorted = *sorted_values;
+	auto count = values.size();
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+		return TemplatedCheckStatistics<uint8_t>(stats, sorted, count);
+	case PhysicalType::UINT16:
+		return TemplatedCheckStatistics<uint16_t>(stats, sorted, count);
+	case PhysicalType::UINT32:
+		return TemplatedCheckStatistics<uint32_t>(stats, sorted, count);
+	case PhysicalType::UINT64:
+		return TemplatedCheckStatistics<uint64_t>(stats, sorted, count);
+	case PhysicalType::UINT128:
+		return TemplatedCheckStatistics<uhugeint_t>(stats, sorted, count);
+	case PhysicalType::INT8:
+		return TemplatedCheckStatistics<int8_t>(stats, sorted, count);
+	case PhysicalType::INT16:
+		return TemplatedCheckStatistics<int16_t>(stats, sorted, count);
+	case PhysicalType::INT32:
+		return TemplatedCheckStatistics<int32_t>(stats, sorted, count);
+	case PhysicalType::INT64:
+		return TemplatedCheckStatistics<int64_t>(stats, sorted, count);
+	case PhysicalType::INT128:
+		return TemplatedCheckStatistics<hugeint_t>(stats, sorted, count);
+	case PhysicalType::FLOAT:
+		return TemplatedCheckStatistics<float>(stats, sorted, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedCheckStatistics<double>(stats, sorted, count);
+	case PhysicalType::VARCHAR: {
+		// string statistics only contain a prefix - only prune on the range of the set
+		auto lower = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+		                                       StringValue::Get(values.front()));
+		auto upper = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_LESSTHANOREQUALTO,
+		                                       StringValue::Get(values.back()));
+		if (lower == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    upper == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &value : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += value.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
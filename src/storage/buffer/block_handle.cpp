@@ -11,6 +11,7 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
+      load_seq_num(0), eviction_queue_idx(0), single_use_eviction_seq_num(0),
       destroy_buffer_upon(DestroyBufferUpon::BLOCK), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
       unswizzled(nullptr) {
 	eviction_seq_num = 0;
@@ -21,9 +22,9 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag,
                          unique_ptr<FileBuffer> buffer_p, DestroyBufferUpon destroy_buffer_upon_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
-    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      destroy_buffer_upon(destroy_buffer_upon_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0), load_seq_num(0),
+      eviction_queue_idx(0), single_use_eviction_seq_num(0), destroy_buffer_upon(destroy_buffer_upon_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -36,7 +37,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes(buffer->type);
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
@@ -78,6 +79,8 @@ BufferHandle BlockHandle::LoadFromBuffer(data_ptr_t data, unique_ptr<FileBuffer>
 	memcpy(block->InternalBuffer(), data, block->AllocSize());
 	buffer = std::move(block);
 	state = BlockState::BLOCK_LOADED;
+	// the buffer handle of the prefetch is discarded right away, that unpin does not count as a use of the block
+	load_seq_num = eviction_seq_num.load() + 1;
 	return BufferHandle(shared_from_this());
 }
 
@@ -100,6 +103,7 @@ BufferHandle BlockHandle::Load(unique_ptr<FileBuffer> reusable_buffer) {
 		}
 	}
 	state = BlockState::BLOCK_LOADED;
+	load_seq_num = eviction_seq_num.load();
 	return BufferHandle(shared_from_this());
 }
 
@@ -198,10 +198,10 @@ BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
                        idx_t allocator_bulk_deallocation_flush_threshold)
     : maximum_memory(maximum_memory),
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
-      track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+      track_eviction_timestamps(track_eviction_timestamps), eviction_policy(BufferEvictionPolicy::LRU),
+      single_use_evictions(0), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+	queues.reserve(EVICTION_QUEUE_COUNT);
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
@@ -209,8 +209,6 @@ BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
@@ -224,19 +222,56 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
 
-	// Get the eviction queue for the buffer type and add it
-	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
+	// Get the eviction queue for the block handle and add it
+	auto queue_idx = GetEvictionQueueIndex(*handle, ts);
+	handle->eviction_queue_idx = queue_idx;
+	return queues[queue_idx]->AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
 EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+idx_t BufferPool::GetEvictionQueueIndex(BlockHandle &handle, idx_t eviction_seq_num) {
+	auto type = handle.buffer->type;
+	idx_t type_queue_idx = uint8_t(type) - 1;
+	if (type != FileBufferType::BLOCK || eviction_policy != BufferEvictionPolicy::TWO_QUEUE) {
+		return type_queue_idx;
+	}
+	// the block was unpinned before since it was loaded: it is used repeatedly
+	if (eviction_seq_num - handle.load_seq_num > 1) {
+		return FREQUENT_BLOCK_QUEUE_IDX;
+	}
+	// the block was recently evicted after being used only once, and is used again
+	// we only remember the most recent single-use evictions, i.e., roughly half the blocks that fit into the pool
+	auto single_use_eviction_seq_num = handle.single_use_eviction_seq_num.load();
+	if (single_use_eviction_seq_num != 0) {
+		auto history_size = MaxValue<idx_t>(maximum_memory / handle.block_manager.GetBlockAllocSize() / 2, 1);
+		if (single_use_evictions - single_use_eviction_seq_num < history_size) {
+			return FREQUENT_BLOCK_QUEUE_IDX;
+		}
+	}
+	return type_queue_idx;
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	if (handle.eviction_seq_num == 0) {
+		// the block handle was never added to an eviction queue
+		GetEvictionQueueForType(handle.buffer->type).IncrementDeadNodes();
+		return;
+	}
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -268,6 +303,13 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		return block_result;
 	}
 
+	// Then, we try to evict persistent table data that is used repeatedly
+	auto frequent_block_result =
+	    EvictBlocksInternal(*queues[FREQUENT_BLOCK_QUEUE_IDX], tag, extra_memory, memory_limit, buffer);
+	if (frequent_block_result.success) {
+		return frequent_block_result;
+	}
+
 	// If that does not succeed, we try to evict temporary data
 	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
 	                                                 extra_memory, memory_limit, buffer);
@@ -292,7 +334,13 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
+	bool track_single_use = &queue == &GetEvictionQueueForType(FileBufferType::BLOCK) &&
+	                        eviction_policy == BufferEvictionPolicy::TWO_QUEUE;
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+		if (track_single_use) {
+			// remember that this block was evicted after being used only once
+			handle->single_use_eviction_seq_num = ++single_use_evictions;
+		}
 		// hooray, we can unload the block
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
@@ -383,6 +431,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		queues[FREQUENT_BLOCK_QUEUE_IDX]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
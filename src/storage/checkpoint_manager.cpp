@@ -28,6 +28,7 @@
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -575,9 +576,21 @@ void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserialize
 	auto &binary_deserializer = dynamic_cast<BinaryDeserializer &>(deserializer);
 	auto &reader = dynamic_cast<MetadataReader &>(binary_deserializer.GetStream());
 
-	MetadataReader table_data_reader(reader.GetMetadataManager(), table_pointer);
-	TableDataReader data_reader(table_data_reader, bound_info);
-	data_reader.ReadTableData();
+	auto &columns = bound_info.Base().columns;
+	vector<LogicalType> types;
+	for (auto &col : columns.Physical()) {
+		types.push_back(col.Type());
+	}
+	bound_info.data = make_uniq<PersistentTableData>(columns.LogicalColumnCount());
+	if (total_rows > 0) {
+		// the statistics and row group pointers of the table are only read when the table is first accessed
+		bound_info.data->lazy_data =
+		    make_shared_ptr<LazyTableData>(reader.GetMetadataManager(), table_pointer, std::move(types));
+	} else {
+		MetadataReader table_data_reader(reader.GetMetadataManager(), table_pointer);
+		TableDataReader data_reader(table_data_reader, types, *bound_info.data);
+		data_reader.ReadTableData();
+	}
 
 	bound_info.data->total_rows = total_rows;
 }
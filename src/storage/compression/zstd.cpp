@@ -0,0 +1,524 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a number of independently compressed frames
+// | frame_count | frame header | compressed frame | frame header | compressed frame | ...
+// Every frame holds at most STANDARD_VECTOR_SIZE rows, so a vector can be scanned by decompressing a single frame
+// The decompressed frame consists of the string lengths of the rows, followed by the string data of the rows
+typedef struct {
+	uint32_t row_count;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_header_t;
+
+struct ZSTDStorage {
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.2;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+	static constexpr int COMPRESSION_LEVEL = 3;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	//! The maximum uncompressed size of a frame, such that the compressed frame is guaranteed to fit in an empty block
+	static idx_t GetMaximumFrameSize(idx_t block_size);
+	//! Compress a frame into the target buffer, returns the compressed size
+	static idx_t CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t source, idx_t source_size,
+	                           data_ptr_t target, idx_t target_capacity);
+	//! Decompress a frame into the target buffer, which has to hold the uncompressed size of the frame
+	static void DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, const zstd_frame_header_t &header,
+	                            const_data_ptr_t source, data_ptr_t target);
+};
+
+idx_t ZSTDStorage::GetMaximumFrameSize(idx_t block_size) {
+	auto available = block_size - sizeof(uint32_t) - sizeof(zstd_frame_header_t);
+	idx_t frame_size = available;
+	while (duckdb_zstd::ZSTD_compressBound(frame_size) > available) {
+		frame_size -= duckdb_zstd::ZSTD_compressBound(frame_size) - available;
+	}
+	return frame_size;
+}
+
+idx_t ZSTDStorage::CompressFrame(duckdb_zstd::ZSTD_CCtx *context, const_data_ptr_t source, idx_t source_size,
+                                 data_ptr_t target, idx_t target_capacity) {
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compressCCtx(context, target, target_capacity, source, source_size, COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	return compressed_size;
+}
+
+void ZSTDStorage::DecompressFrame(duckdb_zstd::ZSTD_DCtx *context, const zstd_frame_header_t &header,
+                                  const_data_ptr_t source, data_ptr_t target) {
+	auto decompressed_size = duckdb_zstd::ZSTD_decompressDCtx(context, target, header.uncompressed_size, source,
+	                                                          header.compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size)) {
+		throw IOException("ZSTD decompression failed: %s", duckdb_zstd::ZSTD_getErrorName(decompressed_size));
+	}
+	if (decompressed_size != header.uncompressed_size) {
+		throw IOException("ZSTD decompression failed: expected %llu bytes, but got %llu bytes",
+		                  idx_t(header.uncompressed_size), idx_t(decompressed_size));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState(const CompressionInfo &info, bool forced, bool enabled, idx_t min_string_length)
+	    : AnalyzeState(info), forced(forced), enabled(enabled), min_string_length(min_string_length),
+	      max_frame_size(ZSTDStorage::GetMaximumFrameSize(info.GetBlockSize())) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+	}
+
+	~ZSTDAnalyzeState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	//! Whether ZSTD compression was forced, in which case the minimum string length does not apply
+	bool forced;
+	//! Whether ZSTD compression can be chosen, older versions of DuckDB cannot read ZSTD segments
+	bool enabled;
+	idx_t min_string_length;
+	idx_t max_frame_size;
+
+	idx_t count = 0;
+	idx_t valid_count = 0;
+	idx_t total_string_size = 0;
+
+	idx_t sampled_size = 0;
+	idx_t sampled_compressed_size = 0;
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	vector<data_t> sample_buffer;
+	vector<data_t> compress_buffer;
+	RandomEngine random_engine;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	auto forced = config.options.force_compression == CompressionType::COMPRESSION_ZSTD;
+	auto &serialization_compatibility = config.options.serialization_compatibility;
+	auto v1_0_0_storage = serialization_compatibility.serialization_version < 3;
+	// older versions of DuckDB cannot read ZSTD segments - if compatibility with them was requested explicitly, even
+	// forced ZSTD compression falls back to uncompressed segments
+	auto enabled = !v1_0_0_storage || (forced && !serialization_compatibility.manually_set);
+	return make_uniq<ZSTDAnalyzeState>(info, forced, enabled, config.options.zstd_min_string_length);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (!state.enabled) {
+		return false;
+	}
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	idx_t valid_count = 0;
+	idx_t vector_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		// every string has to fit in a frame by itself
+		auto string_size = data[idx].GetSize();
+		if (string_size + sizeof(uint32_t) > state.max_frame_size) {
+			return false;
+		}
+		valid_count++;
+		vector_size += string_size;
+	}
+	state.count += count;
+	state.valid_count += valid_count;
+	state.total_string_size += vector_size;
+
+	// only sample vectors that could be compressed with ZSTD, compressing them is expensive
+	if (valid_count == 0 || (!state.forced && vector_size < valid_count * state.min_string_length)) {
+		return true;
+	}
+	if (state.sampled_size > 0 && state.random_engine.NextRandom() >= ANALYSIS_SAMPLE_SIZE) {
+		return true;
+	}
+
+	// compress the vector as a frame, the vector might have to be split over several frames
+	idx_t frame_start = 0;
+	while (frame_start < count) {
+		state.sample_buffer.clear();
+		idx_t frame_end = frame_start;
+		idx_t frame_size = 0;
+		for (; frame_end < count; frame_end++) {
+			auto idx = vdata.sel->get_index(frame_end);
+			auto string_size = vdata.validity.RowIsValid(idx) ? data[idx].GetSize() : 0;
+			if (frame_size + sizeof(uint32_t) + string_size > state.max_frame_size) {
+				break;
+			}
+			frame_size += sizeof(uint32_t) + string_size;
+			if (string_size > 0) {
+				auto str_data = const_data_ptr_cast(data[idx].GetData());
+				state.sample_buffer.insert(state.sample_buffer.end(), str_data, str_data + string_size);
+			}
+		}
+		state.compress_buffer.resize(duckdb_zstd::ZSTD_compressBound(state.sample_buffer.size()));
+		state.sampled_compressed_size +=
+		    CompressFrame(state.context, state.sample_buffer.data(), state.sample_buffer.size(),
+		                  state.compress_buffer.data(), state.compress_buffer.size()) +
+		    sizeof(zstd_frame_header_t) + (frame_end - frame_start) * sizeof(uint32_t);
+		state.sampled_size += frame_size;
+		frame_start = frame_end;
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (!state.enabled || state.valid_count == 0 || state.sampled_size == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	if (!state.forced && state.total_string_size < state.valid_count * state.min_string_length) {
+		// the strings are too short for ZSTD to be worth it, FSST or dictionary compression are better suited
+		return DConstants::INVALID_INDEX;
+	}
+	auto uncompressed_size = double(state.total_string_size + state.count * sizeof(uint32_t));
+	auto compression_ratio = double(state.sampled_size) / double(state.sampled_compressed_size);
+	auto estimated_size = uncompressed_size / compression_ratio;
+	return LossyNumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      max_frame_size(ZSTDStorage::GetMaximumFrameSize(info.GetBlockSize())) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+		compress_buffer.resize(duckdb_zstd::ZSTD_compressBound(max_frame_size));
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		frame_count = 0;
+		segment_size = sizeof(uint32_t);
+	}
+
+	void AddString(bool is_valid, string_t str) {
+		auto string_size = is_valid ? str.GetSize() : 0;
+		if (frame_lengths.size() == STANDARD_VECTOR_SIZE ||
+		    FrameSize() + sizeof(uint32_t) + string_size > max_frame_size) {
+			FlushFrame();
+		}
+		frame_lengths.push_back(NumericCast<uint32_t>(string_size));
+		frame_validity.push_back(is_valid);
+		if (string_size > 0) {
+			auto str_data = const_data_ptr_cast(str.GetData());
+			frame_data.insert(frame_data.end(), str_data, str_data + string_size);
+		}
+	}
+
+	idx_t FrameSize() const {
+		return frame_lengths.size() * sizeof(uint32_t) + frame_data.size();
+	}
+
+	void FlushFrame() {
+		if (frame_lengths.empty()) {
+			return;
+		}
+		// gather the frame: the string lengths followed by the string data
+		auto uncompressed_size = FrameSize();
+		frame_buffer.resize(uncompressed_size);
+		auto lengths_size = frame_lengths.size() * sizeof(uint32_t);
+		memcpy(frame_buffer.data(), frame_lengths.data(), lengths_size);
+		if (!frame_data.empty()) {
+			memcpy(frame_buffer.data() + lengths_size, frame_data.data(), frame_data.size());
+		}
+		auto compressed_size = ZSTDStorage::CompressFrame(context, frame_buffer.data(), uncompressed_size,
+		                                                  compress_buffer.data(), compress_buffer.size());
+
+		// write the frame to the current segment, or to a new segment if it does not fit
+		auto required_size = sizeof(zstd_frame_header_t) + compressed_size;
+		if (segment_size + required_size > info.GetBlockSize()) {
+			FlushSegment();
+			CreateEmptySegment(current_segment_start);
+			if (segment_size + required_size > info.GetBlockSize()) {
+				throw InternalException("ZSTD string compression failed due to insufficient space in empty block");
+			}
+		}
+		auto frame_ptr = current_handle.Ptr() + segment_size;
+		zstd_frame_header_t header;
+		header.row_count = NumericCast<uint32_t>(frame_lengths.size());
+		header.compressed_size = NumericCast<uint32_t>(compressed_size);
+		header.uncompressed_size = NumericCast<uint32_t>(uncompressed_size);
+		memcpy(frame_ptr, &header, sizeof(zstd_frame_header_t));
+		memcpy(frame_ptr + sizeof(zstd_frame_header_t), compress_buffer.data(), compressed_size);
+		segment_size += required_size;
+		frame_count++;
+
+		// update the statistics of the segment with the strings of the frame
+		auto string_ptr = const_char_ptr_cast(frame_data.data());
+		for (idx_t i = 0; i < frame_lengths.size(); i++) {
+			if (frame_validity[i]) {
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats,
+				                                             string_t(string_ptr, frame_lengths[i]));
+			}
+			string_ptr += frame_lengths[i];
+		}
+		current_segment->count += frame_lengths.size();
+
+		frame_lengths.clear();
+		frame_validity.clear();
+		frame_data.clear();
+	}
+
+	void FlushSegment() {
+		current_segment_start = current_segment->start + current_segment->count;
+		Store<uint32_t>(NumericCast<uint32_t>(frame_count), current_handle.Ptr());
+		current_handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment();
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	idx_t max_frame_size;
+
+	duckdb_zstd::ZSTD_CCtx *context;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	idx_t current_segment_start = 0;
+	idx_t frame_count;
+	idx_t segment_size;
+
+	// Buffers for the current frame
+	vector<uint32_t> frame_lengths;
+	vector<bool> frame_validity;
+	vector<data_t> frame_data;
+	vector<data_t> frame_buffer;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.AddString(vdata.validity.RowIsValid(idx), data[idx]);
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDScanState() {
+		context = duckdb_zstd::ZSTD_createDCtx();
+	}
+
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	void Reset(data_ptr_t base_ptr) {
+		frame_count = Load<uint32_t>(base_ptr);
+		frame_index = 0;
+		frame_ptr = base_ptr + sizeof(uint32_t);
+		frame_row_start = 0;
+		memcpy(&frame_header, frame_ptr, sizeof(zstd_frame_header_t));
+		frame_buffer.reset();
+	}
+
+	//! Move to the frame that holds the row, and decompress it
+	void LoadFrame(data_ptr_t base_ptr, idx_t row) {
+		if (row < frame_row_start) {
+			Reset(base_ptr);
+		}
+		while (row >= frame_row_start + frame_header.row_count) {
+			D_ASSERT(frame_index + 1 < frame_count);
+			frame_row_start += frame_header.row_count;
+			frame_ptr += sizeof(zstd_frame_header_t) + frame_header.compressed_size;
+			frame_index++;
+			memcpy(&frame_header, frame_ptr, sizeof(zstd_frame_header_t));
+			frame_buffer.reset();
+		}
+		if (frame_buffer) {
+			return;
+		}
+		// the strings of the result point into the decompressed frame, which is therefore never reused
+		frame_buffer = make_buffer<VectorBuffer>(frame_header.uncompressed_size);
+		ZSTDStorage::DecompressFrame(context, frame_header, frame_ptr + sizeof(zstd_frame_header_t),
+		                             frame_buffer->GetData());
+		auto lengths = frame_buffer->GetData();
+		auto string_ptr = lengths + frame_header.row_count * sizeof(uint32_t);
+		frame_offsets.resize(frame_header.row_count + 1);
+		for (idx_t i = 0; i < frame_header.row_count; i++) {
+			frame_offsets[i] = string_ptr;
+			string_ptr += Load<uint32_t>(lengths + i * sizeof(uint32_t));
+		}
+		frame_offsets[frame_header.row_count] = string_ptr;
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+
+	idx_t frame_count;
+	idx_t frame_index;
+	data_ptr_t frame_ptr;
+	idx_t frame_row_start;
+	zstd_frame_header_t frame_header;
+
+	//! The decompressed current frame, and the start of the strings within it
+	buffer_ptr<VectorBuffer> frame_buffer;
+	vector<data_ptr_t> frame_offsets;
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	state->Reset(state->handle.Ptr() + segment.GetBlockOffset());
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		scan_state.LoadFrame(base_ptr, row);
+		auto frame_end = scan_state.frame_row_start + scan_state.frame_header.row_count;
+		auto frame_scan_count = MinValue<idx_t>(scan_count - scanned, frame_end - row);
+		auto frame_offset = row - scan_state.frame_row_start;
+		for (idx_t i = 0; i < frame_scan_count; i++) {
+			auto string_start = scan_state.frame_offsets[frame_offset + i];
+			auto string_end = scan_state.frame_offsets[frame_offset + i + 1];
+			result_data[result_offset + scanned + i] =
+			    string_t(const_char_ptr_cast(string_start), UnsafeNumericCast<uint32_t>(string_end - string_start));
+		}
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		scanned += frame_scan_count;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+
+	// find the frame that holds the row
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto frame_ptr = base_ptr + sizeof(uint32_t);
+	zstd_frame_header_t header;
+	memcpy(&header, frame_ptr, sizeof(zstd_frame_header_t));
+	while (row >= header.row_count) {
+		row -= header.row_count;
+		frame_ptr += sizeof(zstd_frame_header_t) + header.compressed_size;
+		memcpy(&header, frame_ptr, sizeof(zstd_frame_header_t));
+	}
+
+	auto context = duckdb_zstd::ZSTD_createDCtx();
+	auto frame_buffer = make_unsafe_uniq_array_uninitialized<data_t>(header.uncompressed_size);
+	try {
+		DecompressFrame(context, header, frame_ptr + sizeof(zstd_frame_header_t), frame_buffer.get());
+	} catch (...) {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+		throw;
+	}
+	duckdb_zstd::ZSTD_freeDCtx(context);
+
+	auto lengths = frame_buffer.get();
+	auto string_ptr = lengths + header.row_count * sizeof(uint32_t);
+	for (idx_t i = 0; i < row; i++) {
+		string_ptr += Load<uint32_t>(lengths + i * sizeof(uint32_t));
+	}
+	auto string_length = Load<uint32_t>(lengths + row * sizeof(uint32_t));
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, const_char_ptr_cast(string_ptr), string_length);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
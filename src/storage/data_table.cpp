@@ -7,6 +7,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/planner/expression_binder/check_binder.hpp"
@@ -32,7 +33,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_index_delete_commit(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -43,6 +45,16 @@ bool DataTableInfo::IsTemporary() const {
 	return db.IsTemporary();
 }
 
+void DataTableInfo::RegisterIndexDelete(transaction_t commit_id) {
+	auto last_commit = last_index_delete_commit.load();
+	while (last_commit < commit_id && !last_index_delete_commit.compare_exchange_weak(last_commit, commit_id)) {
+	}
+}
+
+bool DataTableInfo::IndexesMissVisibleRows(transaction_t start_time) const {
+	return start_time <= last_index_delete_commit.load();
+}
+
 DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, const string &schema,
                      const string &table, vector<ColumnDefinition> column_definitions_p,
                      unique_ptr<PersistentTableData> data)
@@ -52,7 +64,7 @@ DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_m
 	auto types = GetTypes();
 	this->row_groups =
 	    make_shared_ptr<RowGroupCollection>(info, TableIOManager::Get(*this).GetBlockManagerForRowData(), types, 0);
-	if (data && data->row_group_count > 0) {
+	if (data && (data->row_group_count > 0 || data->lazy_data)) {
 		this->row_groups->Initialize(*data);
 	} else {
 		this->row_groups->InitializeEmpty();
@@ -249,12 +261,25 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 	row_groups->InitializeScanWithOffset(state.table_state, column_ids, start_row, end_row);
 }
 
-idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = Storage::ROW_GROUP_VECTOR_COUNT;
+idx_t DataTable::GetMorselVectorCount(ClientContext &context) {
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
-		parallel_scan_vector_count = 1;
+		return 1;
+	}
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	auto vector_count = (GetTotalRows() + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+	if (thread_count <= 1 || vector_count >= thread_count * Storage::ROW_GROUP_VECTOR_COUNT) {
+		// there are enough row groups to keep all threads busy
+		return Storage::ROW_GROUP_VECTOR_COUNT;
 	}
-	idx_t parallel_scan_tuple_count = STANDARD_VECTOR_SIZE * parallel_scan_vector_count;
+	// there are fewer row groups than threads - split the row groups into smaller morsels so that all threads
+	// can participate in the scan (and the work that is done on the scanned data)
+	auto morsel_vector_count = vector_count / (thread_count * MORSELS_PER_THREAD);
+	return MinValue<idx_t>(MaxValue<idx_t>(morsel_vector_count, MIN_MORSEL_VECTOR_COUNT),
+	                       Storage::ROW_GROUP_VECTOR_COUNT);
+}
+
+idx_t DataTable::MaxThreads(ClientContext &context) {
+	idx_t parallel_scan_tuple_count = STANDARD_VECTOR_SIZE * GetMorselVectorCount(context);
 	return GetTotalRows() / parallel_scan_tuple_count + 1;
 }
 
@@ -262,7 +287,7 @@ void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScan
 	auto &local_storage = LocalStorage::Get(context, db);
 	auto &transaction = DuckTransaction::Get(context, db);
 	state.checkpoint_lock = transaction.SharedLockTable(*info);
-	row_groups->InitializeParallelScan(state.scan_state);
+	row_groups->InitializeParallelScan(state.scan_state, GetMorselVectorCount(context));
 
 	local_storage.InitializeParallelScan(*this, state.local_state);
 }
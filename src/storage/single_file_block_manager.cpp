@@ -523,6 +523,11 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, GetBlockLocation(block.id));
 }
 
+void SingleFileBlockManager::ReadAhead(block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	handle->ReadAhead(GetBlockLocation(start_block), block_count * GetBlockAllocSize());
+}
+
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	D_ASSERT(start_block >= 0);
 	D_ASSERT(block_count >= 1);
@@ -256,8 +256,7 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 	}
 }
 
-void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
-	// figure out which set of blocks we should load
+map<block_id_t, idx_t> StandardBufferManager::GetBlocksToLoad(vector<shared_ptr<BlockHandle>> &handles) {
 	map<block_id_t, idx_t> to_be_loaded;
 	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
 		auto &handle = handles[block_idx];
@@ -267,33 +266,56 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
 		}
 	}
-	if (to_be_loaded.empty()) {
-		// nothing to fetch
-		return;
-	}
-	// iterate over the blocks and perform bulk reads
+	return to_be_loaded;
+}
+
+//! Calls op(first_block, last_block) for every run of adjacent block ids
+template <class OP>
+static void ForEachBlockRun(const map<block_id_t, idx_t> &blocks, OP &&op) {
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
-	for (auto &entry : to_be_loaded) {
+	for (auto &entry : blocks) {
 		if (previous_block_id < 0) {
 			// this the first block we are seeing
 			first_block = entry.first;
 			previous_block_id = first_block;
 		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
+			// this block is adjacent to the previous block - add it to the run
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - handle the previous run
+			op(first_block, previous_block_id);
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	if (previous_block_id >= 0) {
+		// handle the final run
+		op(first_block, previous_block_id);
+	}
+}
+
+void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	// figure out which set of blocks we should load
+	auto to_be_loaded = GetBlocksToLoad(handles);
+	// iterate over the blocks and perform bulk reads
+	ForEachBlockRun(to_be_loaded, [&](block_id_t first_block, block_id_t last_block) {
+		BatchRead(handles, to_be_loaded, first_block, last_block);
+	});
+}
+
+void StandardBufferManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	if (handles.empty()) {
+		return;
+	}
+	auto to_be_loaded = GetBlocksToLoad(handles);
+	// issue a single read-ahead for every run of adjacent blocks
+	auto &block_manager = handles[0]->block_manager;
+	ForEachBlockRun(to_be_loaded, [&](block_id_t first_block, block_id_t last_block) {
+		block_manager.ReadAhead(first_block, NumericCast<idx_t>(last_block - first_block + 1));
+	});
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -230,7 +230,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-enum class WALCommitState { IN_PROGRESS, FLUSHED, TRUNCATED };
+enum class WALCommitState { IN_PROGRESS, WRITTEN, FLUSHED, TRUNCATED };
 
 struct OptimisticallyWrittenRowGroupData {
 	OptimisticallyWrittenRowGroupData(idx_t start, idx_t count, unique_ptr<PersistentCollectionData> row_group_data_p)
@@ -251,6 +251,10 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	//! Write the commit to the WAL without syncing it to disk
+	void WriteCommit() override;
+	//! Sync the written commit to disk
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -260,6 +264,8 @@ public:
 private:
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	//! The sequence number of the commit in the WAL (after WriteCommit)
+	idx_t commit_sequence = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
@@ -302,6 +308,22 @@ void SingleFileStorageCommitState::FlushCommit() {
 	state = WALCommitState::FLUSHED;
 }
 
+void SingleFileStorageCommitState::WriteCommit() {
+	if (state != WALCommitState::IN_PROGRESS) {
+		return;
+	}
+	commit_sequence = wal.WriteCommit();
+	state = WALCommitState::WRITTEN;
+}
+
+void SingleFileStorageCommitState::SyncCommit() {
+	if (state != WALCommitState::WRITTEN) {
+		return;
+	}
+	wal.SyncCommit(commit_sequence);
+	state = WALCommitState::FLUSHED;
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	if (row_group_data->HasUpdates()) {
@@ -1,4 +1,6 @@
 #include "duckdb/storage/table/persistent_table_data.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
+#include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
@@ -9,4 +11,22 @@ PersistentTableData::PersistentTableData(idx_t column_count) : total_rows(0), ro
 PersistentTableData::~PersistentTableData() {
 }
 
+LazyTableData::LazyTableData(MetadataManager &manager, MetaBlockPointer table_pointer, vector<LogicalType> types_p)
+    : manager(manager), table_pointer(table_pointer), types(std::move(types_p)) {
+}
+
+LazyTableData::~LazyTableData() {
+}
+
+PersistentTableData &LazyTableData::Load() {
+	lock_guard<mutex> guard(lock);
+	if (!data) {
+		data = make_uniq<PersistentTableData>(types.size());
+		MetadataReader table_data_reader(manager, table_pointer);
+		TableDataReader data_reader(table_data_reader, types, *data);
+		data_reader.ReadTableData();
+	}
+	return *data;
+}
+
 } // namespace duckdb
@@ -215,6 +215,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state);
 	return true;
 }
 
@@ -242,9 +243,58 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state);
 	return true;
 }
 
+static void GatherStartedSegmentBlocks(ColumnScanState &scan_state, unordered_set<BlockHandle *> &blocks) {
+	auto segment = scan_state.current;
+	if (segment && segment->block && segment->start < scan_state.row_index) {
+		blocks.insert(segment->block.get());
+	}
+	for (auto &child_state : scan_state.child_states) {
+		GatherStartedSegmentBlocks(child_state, blocks);
+	}
+}
+
+void RowGroup::ReadAhead(CollectionScanState &state) {
+	auto &block_manager = GetBlockManager();
+	if (block_manager.InMemory() || block_manager.IsRemote()) {
+		// remote files are prefetched synchronously (in batches) while scanning instead
+		return;
+	}
+	auto row_offset = state.vector_index * STANDARD_VECTOR_SIZE;
+	if (row_offset >= state.max_row_group_row) {
+		return;
+	}
+	// gather the blocks of all segments we are going to scan (up to the end of the morsel), and let the file system
+	// read them in the background while we are processing the first segments
+	auto &column_ids = state.GetColumnIds();
+	PrefetchState prefetch_state;
+	unordered_set<BlockHandle *> started_blocks;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i],
+			                                     state.max_row_group_row - row_offset);
+			if (row_offset > 0) {
+				GatherStartedSegmentBlocks(state.column_scans[i], started_blocks);
+			}
+		}
+	}
+	if (!started_blocks.empty()) {
+		// the morsel starts in the middle of these segments - the previous morsel of the row group already read them
+		vector<shared_ptr<BlockHandle>> blocks;
+		for (auto &block : prefetch_state.blocks) {
+			if (started_blocks.find(block.get()) == started_blocks.end()) {
+				blocks.push_back(block);
+			}
+		}
+		prefetch_state.blocks = std::move(blocks);
+	}
+	block_manager.buffer_manager.ReadAhead(prefetch_state.blocks);
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -419,6 +469,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -899,10 +952,7 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info(info, column_idx);
-		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+		auto checkpoint_state = WriteColumnToDisk(info, column_idx);
 
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
@@ -931,7 +981,15 @@ bool RowGroup::HasUnloadedDeletes() const {
 	return !deletes_is_loaded;
 }
 
-RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info(info, column_idx);
+	auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
+
+vector<CompressionType> RowGroup::GetCompressionTypes(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -943,7 +1001,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
+	return compression_types;
+}
 
+RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+	auto compression_types = GetCompressionTypes(writer);
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
@@ -6,6 +6,7 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -29,14 +30,25 @@ RowGroupSegmentTree::~RowGroupSegmentTree() {
 }
 
 void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
-	D_ASSERT(data.row_group_count > 0);
+	D_ASSERT(data.row_group_count > 0 || data.lazy_data);
 	current_row_group = 0;
-	max_row_group = data.row_group_count;
 	finished_loading = false;
+	if (data.lazy_data) {
+		// the row group pointers are read on first access
+		lazy_data = data.lazy_data;
+		return;
+	}
+	max_row_group = data.row_group_count;
 	reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
 }
 
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	if (lazy_data) {
+		auto &data = lazy_data->Load();
+		max_row_group = data.row_group_count;
+		reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
+		lazy_data.reset();
+	}
 	if (current_row_group >= max_row_group) {
 		reader.reset();
 		finished_loading = true;
@@ -174,12 +186,14 @@ bool RowGroupCollection::InitializeScanInRowGroup(CollectionScanState &state, Ro
 	return row_group.InitializeScanWithOffset(state, vector_index);
 }
 
-void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
+void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state, idx_t morsel_vector_count) {
+	D_ASSERT(morsel_vector_count > 0 && morsel_vector_count <= Storage::ROW_GROUP_VECTOR_COUNT);
 	state.collection = this;
 	state.current_row_group = row_groups->GetRootSegment();
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
+	state.morsel_vector_count = morsel_vector_count;
 	state.processed_rows = 0;
 }
 
@@ -191,7 +205,7 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		RowGroupCollection *collection;
 		RowGroup *row_group;
 		{
-			// select the next row group to scan from the parallel state
+			// select the next morsel to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
 			if (!state.current_row_group || state.current_row_group->count == 0) {
 				// no more data left to scan
@@ -199,22 +213,22 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
+			auto morsel_vector_count = state.morsel_vector_count;
 			if (ClientConfig::GetConfig(context).verify_parallelism) {
-				vector_index = state.vector_index;
-				max_row = state.current_row_group->start +
-				          MinValue<idx_t>(state.current_row_group->count,
-				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
-				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-				state.vector_index++;
-				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
-					state.vector_index = 0;
-				}
-			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				morsel_vector_count = 1;
+			}
+			// a morsel is (part of) a single row group
+			vector_index = state.vector_index;
+			D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < row_group->count);
+			auto morsel_start = vector_index * STANDARD_VECTOR_SIZE;
+			auto morsel_end =
+			    MinValue<idx_t>(row_group->count, morsel_start + morsel_vector_count * STANDARD_VECTOR_SIZE);
+			max_row = row_group->start + morsel_end;
+			state.processed_rows += morsel_end - morsel_start;
+			state.vector_index += morsel_vector_count;
+			if (state.vector_index * STANDARD_VECTOR_SIZE >= row_group->count) {
+				state.current_row_group = row_groups->GetNextSegment(row_group);
+				state.vector_index = 0;
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -699,6 +713,8 @@ struct CollectionCheckpointState {
 	      global_stats(global_stats) {
 		writers.resize(segments.size());
 		write_data.resize(segments.size());
+		compression_types.resize(segments.size());
+		write_info.resize(segments.size());
 	}
 
 	RowGroupCollection &collection;
@@ -707,6 +723,9 @@ struct CollectionCheckpointState {
 	vector<SegmentNode<RowGroup>> &segments;
 	vector<unique_ptr<RowGroupWriter>> writers;
 	vector<RowGroupWriteData> write_data;
+	//! The compression types and write info of the row groups whose columns are written by separate tasks
+	vector<vector<CompressionType>> compression_types;
+	vector<unique_ptr<RowGroupWriteInfo>> write_info;
 	TableStatistics &global_stats;
 	mutex write_lock;
 };
@@ -738,6 +757,23 @@ private:
 	idx_t index;
 };
 
+class ColumnCheckpointTask : public BaseCheckpointTask {
+public:
+	ColumnCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_idx)
+	    : BaseCheckpointTask(checkpoint_state), index(index), column_idx(column_idx) {
+	}
+
+	void ExecuteTask() override {
+		auto &row_group = *checkpoint_state.segments[index].node;
+		auto &write_info = *checkpoint_state.write_info[index];
+		checkpoint_state.write_data[index].states[column_idx] = row_group.WriteColumnToDisk(write_info, column_idx);
+	}
+
+private:
+	idx_t index;
+	idx_t column_idx;
+};
+
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
@@ -961,6 +997,22 @@ unique_ptr<CheckpointTask> RowGroupCollection::GetCheckpointTask(CollectionCheck
 	return make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
 }
 
+void RowGroupCollection::ScheduleColumnCheckpointTasks(CollectionCheckpointState &checkpoint_state,
+                                                       idx_t segment_idx) {
+	auto &row_group = *checkpoint_state.segments[segment_idx].node;
+	auto &row_group_writer = checkpoint_state.writers[segment_idx];
+	row_group_writer = checkpoint_state.writer.GetRowGroupWriter(row_group);
+	auto &compression_types = checkpoint_state.compression_types[segment_idx];
+	compression_types = row_group.GetCompressionTypes(*row_group_writer);
+	checkpoint_state.write_info[segment_idx] = make_uniq<RowGroupWriteInfo>(
+	    row_group_writer->GetPartialBlockManager(), compression_types, row_group_writer->GetCheckpointType());
+	checkpoint_state.write_data[segment_idx].states.resize(types.size());
+	for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+		auto column_task = make_uniq<ColumnCheckpointTask>(checkpoint_state, segment_idx, column_idx);
+		checkpoint_state.executor.ScheduleTask(std::move(column_task));
+	}
+}
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
@@ -969,6 +1021,9 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 
 	VacuumState vacuum_state;
 	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	// if there are fewer row groups than threads, we write the columns of the row groups in separate tasks
+	auto num_threads = NumericCast<idx_t>(writer.GetScheduler().NumberOfThreads());
+	bool split_columns = segments.size() < num_threads && types.size() > 1;
 	// schedule tasks
 	idx_t total_vacuum_tasks = 0;
 	auto &config = DBConfig::GetConfig(writer.GetDatabase());
@@ -987,8 +1042,12 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		}
 		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		auto checkpoint_task = GetCheckpointTask(checkpoint_state, segment_idx);
-		checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
+		if (split_columns) {
+			ScheduleColumnCheckpointTasks(checkpoint_state, segment_idx);
+		} else {
+			auto checkpoint_task = GetCheckpointTask(checkpoint_state, segment_idx);
+			checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
+		}
 		vacuum_state.row_start += entry.node->count;
 	}
 	// all tasks have been scheduled - execute tasks until we are done
@@ -1007,6 +1066,13 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		if (!row_group_writer) {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
+		auto &write_data = checkpoint_state.write_data[segment_idx];
+		if (write_data.statistics.size() != write_data.states.size()) {
+			// the columns were written by separate tasks - collect their statistics
+			for (auto &state : write_data.states) {
+				write_data.statistics.push_back(state->GetStatistics()->Copy());
+			}
+		}
 		auto pointer =
 		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
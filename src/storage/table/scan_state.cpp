@@ -148,7 +148,8 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), morsel_vector_count(Storage::ROW_GROUP_VECTOR_COUNT),
+      processed_rows(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
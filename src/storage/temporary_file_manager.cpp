@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +98,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+      slot_size(slot_size),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +121,51 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (!IsCompressed()) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// the compressed buffer is (at least) as large as our slots
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (!IsCompressed()) {
+		auto block_size = buffer_manager.GetBlockSize();
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position, block_size,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the slot, which starts with the size of the compressed block
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, position);
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+
+	// decompress it into a block-sized buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)), char_ptr_cast(buffer->InternalBuffer()),
+	    NumericCast<int>(compressed_size), NumericCast<int>(buffer->AllocSize()));
+	if (decompressed_size != NumericCast<int>(buffer->AllocSize())) {
+		throw IOException("Failed to decompress block %llu from temporary file \"%s\"", block_index, path);
+	}
+	return buffer;
+}
+
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size < BufferManager::GetBufferManager(db).GetBlockAllocSize();
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +219,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -280,14 +318,19 @@ TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) :
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +340,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +352,34 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+}
+
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return block_alloc_size;
+	}
+	// compress the buffer, and store the compressed size in front of the compressed data
+	auto uncompressed_size = NumericCast<int>(buffer.AllocSize());
+	auto compressed_bound = duckdb_lz4::LZ4_compressBound(uncompressed_size);
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + NumericCast<idx_t>(compressed_bound));
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.InternalBuffer()),
+	                                                        char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)),
+	                                                        uncompressed_size, compressed_bound);
+	if (compressed_size <= 0) {
+		return block_alloc_size;
+	}
+	auto total_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(total_size);
+	if (slot_size >= block_alloc_size) {
+		// the block does not compress well enough to save space - write it uncompressed
+		return block_alloc_size;
+	}
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer.get());
+	// zero-initialize the remainder of the slot so we don't write uninitialized memory to disk
+	memset(compressed_buffer.get() + total_size, 0, slot_size - total_size);
+	return slot_size;
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
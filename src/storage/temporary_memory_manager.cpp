@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -8,9 +11,9 @@
 
 namespace duckdb {
 
-TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
+TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p, ClientContext &context_p,
                                            idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
 }
 
@@ -66,7 +69,17 @@ idx_t TemporaryMemoryState::GetMaterializationPenalty() const {
 	return materialization_penalty;
 }
 
-TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
+QueryMemoryAdmission::QueryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager_p, ClientContext &context_p,
+                                           idx_t budget_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), budget(budget_p) {
+}
+
+QueryMemoryAdmission::~QueryMemoryAdmission() {
+	temporary_memory_manager.Release(*this);
+}
+
+TemporaryMemoryManager::TemporaryMemoryManager()
+    : reservation(0), remaining_size(0), admitted_budget(0), admitted_queries(0) {
 }
 
 unique_lock<mutex> TemporaryMemoryManager::Lock() {
@@ -79,10 +92,37 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetReservation(temporary_memory_state, 0);
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
+	CleanupQuery(temporary_memory_state.context);
 
 	Verify();
 }
 
+void TemporaryMemoryManager::Release(QueryMemoryAdmission &admission) {
+	auto guard = Lock();
+
+	D_ASSERT(admitted_queries != 0 && admitted_budget >= admission.budget);
+	admitted_budget -= admission.budget;
+	admitted_queries--;
+	auto &query = queries[admission.context];
+	query.admitted = false;
+	query.admitted_budget = 0;
+	CleanupQuery(admission.context);
+
+	// Wake up the queries that are waiting for admission
+	admission_cv.notify_all();
+}
+
+void TemporaryMemoryManager::CleanupQuery(ClientContext &context) {
+	auto entry = queries.find(context);
+	if (entry == queries.end()) {
+		return;
+	}
+	auto &query = entry->second;
+	if (query.reservation == 0 && !query.waiting && !query.admitted) {
+		queries.erase(entry);
+	}
+}
+
 void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	auto &buffer_manager = BufferManager::GetBufferManager(context);
 	auto &task_scheduler = TaskScheduler::GetScheduler(context);
@@ -104,7 +144,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -113,6 +153,65 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
+unique_ptr<QueryMemoryAdmission> TemporaryMemoryManager::AdmitQuery(ClientContext &context) {
+	if (!DBConfig::GetConfig(context).options.query_admission_control) {
+		return nullptr;
+	}
+
+	auto guard = Lock();
+	UpdateConfiguration(context);
+
+	// Queries without a memory limit are admitted with the full memory limit, i.e., they run on their own
+	const auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	auto budget = memory_limit;
+	if (query_memory_limit.IsValid()) {
+		budget = MinValue(budget, query_memory_limit.GetIndex());
+	}
+
+	queries[context].waiting = true;
+	const auto start = std::chrono::steady_clock::now();
+	while (admitted_queries != 0 && admitted_budget + budget > memory_limit) {
+		if (context.interrupted) {
+			queries[context].waiting = false;
+			CleanupQuery(context);
+			throw InterruptException();
+		}
+		const auto waited =
+		    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		if (NumericCast<idx_t>(waited) >= MAXIMUM_ADMISSION_WAIT_MS) {
+			queries[context].waiting = false;
+			CleanupQuery(context);
+			throw OutOfMemoryException(
+			    "Query was not admitted within %llu seconds: it requires a memory budget of %s, but %s of the %s memory "
+			    "limit is admitted to %llu other queries. Set a lower query_memory_limit, or disable "
+			    "query_admission_control",
+			    MAXIMUM_ADMISSION_WAIT_MS / 1000, StringUtil::BytesToHumanReadableString(budget),
+			    StringUtil::BytesToHumanReadableString(admitted_budget),
+			    StringUtil::BytesToHumanReadableString(memory_limit), admitted_queries);
+		}
+		admission_cv.wait_for(guard, std::chrono::milliseconds(ADMISSION_WAIT_INTERVAL_MS));
+	}
+
+	auto &query = queries[context];
+	query.memory_limit = query_memory_limit;
+	query.waiting = false;
+	query.admitted = true;
+	query.admitted_budget = budget;
+	admitted_budget += budget;
+	admitted_queries++;
+
+	return unique_ptr<QueryMemoryAdmission>(new QueryMemoryAdmission(*this, context, budget));
+}
+
+vector<QueryMemoryInformation> TemporaryMemoryManager::GetQueryMemoryInformation() {
+	auto guard = Lock();
+	vector<QueryMemoryInformation> result;
+	for (auto &query : queries) {
+		result.push_back(query.second);
+	}
+	return result;
+}
+
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
@@ -137,11 +236,14 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The memory that the query may still reserve within its memory limit
 		auto upper_bound = MinValue(temporary_memory_state.GetRemainingSize(), query_max_memory);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue(upper_bound,
 		                       LossyNumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * static_cast<double>(free_memory)));
 		upper_bound = MinValue(upper_bound, free_memory);
+		const auto query_free_memory = GetQueryFreeMemory(temporary_memory_state);
+		upper_bound = MinValue(upper_bound, query_free_memory);
 
 		idx_t new_reservation;
 		if (lower_bound >= upper_bound) {
@@ -149,6 +251,8 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		} else {
 			new_reservation = remaining_size > memory_limit ? ComputeReservation(temporary_memory_state) : upper_bound;
 		}
+		// The reservation only exceeds the memory limit of the query if the lower bound does
+		new_reservation = MaxValue(lower_bound, MinValue(new_reservation, query_free_memory));
 
 		SetReservation(temporary_memory_state, new_reservation);
 	}
@@ -165,9 +269,24 @@ void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_me
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.GetReservation());
+	auto &query = queries[temporary_memory_state.context];
+	D_ASSERT(query.reservation >= temporary_memory_state.GetReservation());
 	this->reservation -= temporary_memory_state.GetReservation();
+	query.reservation -= temporary_memory_state.GetReservation();
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.GetReservation();
+	query.reservation += temporary_memory_state.GetReservation();
+}
+
+idx_t TemporaryMemoryManager::GetQueryFreeMemory(const TemporaryMemoryState &temporary_memory_state) {
+	auto &query = queries[temporary_memory_state.context];
+	query.memory_limit = ClientConfig::GetConfig(temporary_memory_state.context).query_memory_limit;
+	if (!query.memory_limit.IsValid()) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	const auto query_memory_limit = query.memory_limit.GetIndex();
+	const auto other_reservation = query.reservation - temporary_memory_state.GetReservation();
+	return query_memory_limit > other_reservation ? query_memory_limit - other_reservation : 0;
 }
 
 //! Compute initial reservation for use in ComputeReservation
@@ -330,6 +449,11 @@ void TemporaryMemoryManager::Verify() const {
 	}
 	D_ASSERT(total_reservation == this->reservation);
 	D_ASSERT(total_remaining_size == this->remaining_size);
+	idx_t total_query_reservation = 0;
+	for (auto &query : queries) {
+		total_query_reservation += query.second.reservation;
+	}
+	D_ASSERT(total_query_reservation == this->reservation);
 #endif
 }
 
@@ -17,6 +17,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -26,23 +28,56 @@
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
 namespace duckdb {
 
+//! The indexes of a table whose maintenance is deferred until the WAL has been replayed
+struct DeferredTableIndexes {
+	explicit DeferredTableIndexes(DataTable &table) : table(table) {
+	}
+
+	DataTable &table;
+	TableIndexList indexes;
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
 	}
 
+	//! The minimum amount of rows a WAL must insert into a table to defer the maintenance of its indexes
+	static constexpr const idx_t DEFERRED_INDEX_MINIMUM_ROWS = Storage::ROW_GROUP_SIZE;
+
 	AttachedDatabase &db;
 	ClientContext &context;
 	Catalog &catalog;
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+	//! The schema and table name of the current table (while deserializing only)
+	string current_schema_name;
+	string current_table_name;
+	//! The amount of rows inserted into each table by the WAL (schema -> table -> rows)
+	case_insensitive_map_t<case_insensitive_map_t<idx_t>> inserted_rows;
+	//! Whether or not the maintenance of indexes can be deferred, i.e., the WAL contains no changes to indexes,
+	//! dropped tables or altered tables
+	bool can_defer_indexes = true;
+	//! The tables that have been checked for deferred index maintenance
+	reference_set_t<DataTable> checked_tables;
+	//! The detached indexes of the tables whose index maintenance is deferred
+	vector<unique_ptr<DeferredTableIndexes>> deferred_indexes;
+
+public:
+	//! Defers the maintenance of the indexes of a table, if the WAL inserts enough rows into the table that rebuilding
+	//! its indexes after the replay is cheaper than maintaining them for every replayed transaction
+	void DeferIndexMaintenance(TableCatalogEntry &table);
+	//! Re-attach and rebuild the deferred indexes, one task per table
+	void RebuildDeferredIndexes();
 };
 
 class WriteAheadLogDeserializer {
@@ -101,6 +136,9 @@ public:
 			deserializer.End();
 			return true;
 		}
+		if (DeserializeOnly() && PreventsDeferredIndexes(wal_type)) {
+			state.can_defer_indexes = false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -112,6 +150,8 @@ public:
 
 protected:
 	void ReplayEntry(WALType wal_type);
+	//! Whether or not an entry changes the indexes or tables in a way that prevents deferring index maintenance
+	static bool PreventsDeferredIndexes(WALType wal_type);
 
 	void ReplayVersion();
 
@@ -209,6 +249,8 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 
 	// we need to recover from the WAL: actually set up the replay state
 	ReplayState state(database, *con.context);
+	state.inserted_rows = std::move(checkpoint_state.inserted_rows);
+	state.can_defer_indexes = checkpoint_state.can_defer_indexes;
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
@@ -246,9 +288,121 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	if (!state.deferred_indexes.empty()) {
+		// rebuild the indexes whose maintenance was deferred during the replay
+		con.BeginTransaction();
+		state.RebuildDeferredIndexes();
+		con.Commit();
+	}
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Deferred Indexes
+//===--------------------------------------------------------------------===//
+void ReplayState::DeferIndexMaintenance(TableCatalogEntry &table) {
+	if (!can_defer_indexes) {
+		return;
+	}
+	auto &storage = table.GetStorage();
+	if (checked_tables.find(storage) != checked_tables.end()) {
+		return;
+	}
+	checked_tables.insert(storage);
+
+	auto &indexes = storage.GetDataTableInfo()->GetIndexes();
+	if (indexes.Empty()) {
+		return;
+	}
+	// we can only rebuild ART indexes - indexes of other types might not be loaded yet
+	bool all_art = true;
+	indexes.Scan([&](Index &index) {
+		all_art = index.GetIndexType() == ART::TYPE_NAME;
+		return !all_art;
+	});
+	if (!all_art) {
+		return;
+	}
+	// rebuilding the indexes scans the entire table: only defer if the WAL inserts at least as many rows
+	idx_t row_count = 0;
+	auto schema_entry = inserted_rows.find(table.schema.name);
+	if (schema_entry != inserted_rows.end()) {
+		auto table_entry = schema_entry->second.find(table.name);
+		if (table_entry != schema_entry->second.end()) {
+			row_count = table_entry->second;
+		}
+	}
+	if (row_count < DEFERRED_INDEX_MINIMUM_ROWS || row_count < storage.GetTotalRows()) {
+		return;
+	}
+	auto deferred = make_uniq<DeferredTableIndexes>(storage);
+	deferred->indexes.Move(indexes);
+	deferred_indexes.push_back(std::move(deferred));
+}
+
+class RebuildIndexesTask : public BaseExecutorTask {
+public:
+	RebuildIndexesTask(TaskExecutor &executor, DataTable &table) : BaseExecutorTask(executor), table(table) {
+	}
+
+	void ExecuteTask() override {
+		// scan all committed rows of the table together with their row identifiers
+		vector<column_t> column_ids;
+		auto types = table.GetTypes();
+		for (idx_t i = 0; i < types.size(); i++) {
+			column_ids.push_back(i);
+		}
+		column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		types.push_back(LogicalType::ROW_TYPE);
+
+		DataChunk chunk;
+		chunk.Initialize(Allocator::Get(table.db), types);
+		TableScanState scan_state;
+		table.InitializeScan(scan_state, column_ids);
+
+		auto &indexes = table.GetDataTableInfo()->GetIndexes();
+		while (true) {
+			chunk.Reset();
+			table.CreateIndexScan(scan_state, chunk, TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+			if (chunk.size() == 0) {
+				break;
+			}
+			auto &row_ids = chunk.data.back();
+			indexes.Scan([&](Index &index) {
+				auto error = index.Cast<BoundIndex>().Append(chunk, row_ids);
+				if (error.HasError()) {
+					error.Throw();
+				}
+				return false;
+			});
+		}
+	}
+
+private:
+	DataTable &table;
+};
+
+void ReplayState::RebuildDeferredIndexes() {
+	// re-attach the indexes to their tables and clear them
+	for (auto &deferred : deferred_indexes) {
+		auto &table = deferred->table;
+		table.GetDataTableInfo()->GetIndexes().Move(deferred->indexes);
+		table.InitializeIndexes(context);
+		table.GetDataTableInfo()->GetIndexes().Scan([&](Index &index) {
+			index.CommitDrop();
+			return false;
+		});
+	}
+	// the tables are independent: rebuild their indexes in parallel
+	TaskExecutor executor(TaskScheduler::GetScheduler(db.GetDatabase()));
+	for (auto &deferred : deferred_indexes) {
+		auto task = make_uniq<RebuildIndexesTask>(executor, deferred->table);
+		executor.ScheduleTask(std::move(task));
+	}
+	executor.WorkOnTasks();
+	deferred_indexes.clear();
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
@@ -334,6 +488,19 @@ void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
 	}
 }
 
+bool WriteAheadLogDeserializer::PreventsDeferredIndexes(WALType wal_type) {
+	switch (wal_type) {
+	case WALType::ALTER_INFO:
+	case WALType::DROP_TABLE:
+	case WALType::DROP_SCHEMA:
+	case WALType::CREATE_INDEX:
+	case WALType::DROP_INDEX:
+		return true;
+	default:
+		return false;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Version
 //===--------------------------------------------------------------------===//
@@ -636,15 +803,19 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 	auto schema_name = deserializer.ReadProperty<string>(101, "schema");
 	auto table_name = deserializer.ReadProperty<string>(102, "table");
 	if (DeserializeOnly()) {
+		state.current_schema_name = schema_name;
+		state.current_table_name = table_name;
 		return;
 	}
 	state.current_table = &catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name);
+	state.DeferIndexMaintenance(*state.current_table);
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
 	DataChunk chunk;
 	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
 	if (DeserializeOnly()) {
+		state.inserted_rows[state.current_schema_name][state.current_table_name] += chunk.size();
 		return;
 	}
 	if (!state.current_table) {
@@ -22,7 +22,7 @@ namespace duckdb {
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), written_commits(0), synced_commits(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -423,4 +423,32 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+idx_t WriteAheadLog::WriteCommit() {
+	D_ASSERT(writer);
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// pass the changes made to the WAL to the OS - they are synced to disk in SyncCommit
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	return ++written_commits;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit_sequence) {
+	if (synced_commits >= commit_sequence) {
+		return;
+	}
+	lock_guard<mutex> guard(sync_lock);
+	if (synced_commits >= commit_sequence) {
+		// the commit was synced by a concurrent commit while we were waiting
+		return;
+	}
+	// all commits written up to this point have been passed to the OS - sync them together
+	idx_t sync_commits = written_commits;
+	writer->handle->Sync();
+	synced_commits = sync_commits;
+}
+
 } // namespace duckdb
@@ -13,8 +13,8 @@
 
 namespace duckdb {
 
-CleanupState::CleanupState(transaction_t lowest_active_transaction)
-    : lowest_active_transaction(lowest_active_transaction), current_table(nullptr), count(0) {
+CleanupState::CleanupState(transaction_t lowest_active_transaction, transaction_t commit_id)
+    : lowest_active_transaction(lowest_active_transaction), commit_id(commit_id), current_table(nullptr), count(0) {
 }
 
 CleanupState::~CleanupState() {
@@ -73,6 +73,10 @@ void CleanupState::CleanupDelete(DeleteInfo &info) {
 
 	// possibly vacuum any indexes in this table later
 	indexed_tables[current_table->GetTableName()] = current_table;
+	if (lowest_active_transaction <= commit_id) {
+		// transactions that started before the delete can still see the rows, but they are removed from the indexes
+		current_table->GetDataTableInfo()->RegisterIndexDelete(commit_id);
+	}
 
 	count = 0;
 	if (info.is_consecutive) {
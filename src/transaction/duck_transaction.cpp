@@ -217,7 +217,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 }
 
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
+                                  optional_ptr<StorageCommitState> commit_state) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
@@ -234,8 +234,9 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		storage->Commit(commit_state.get());
 		undo_buffer.Commit(iterator_state, commit_id);
 		if (commit_state) {
-			// if we have written to the WAL - flush after the commit has been successful
-			commit_state->FlushCommit();
+			// if we have written to the WAL - write the commit after it has been successful
+			// the caller syncs the WAL after releasing the WAL lock, so that concurrent commits share the sync
+			commit_state->WriteCommit();
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
@@ -254,7 +255,7 @@ void DuckTransaction::Rollback() noexcept {
 }
 
 void DuckTransaction::Cleanup(transaction_t lowest_active_transaction) {
-	undo_buffer.Cleanup(lowest_active_transaction);
+	undo_buffer.Cleanup(lowest_active_transaction, commit_id);
 }
 
 void DuckTransaction::SetReadWrite() {
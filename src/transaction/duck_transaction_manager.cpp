@@ -13,6 +13,8 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/error_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -34,6 +36,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -51,7 +54,16 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 	if (!meta_transaction.IsReadOnly()) {
 		start_lock = make_uniq<lock_guard<mutex>>(start_transaction_lock);
 	}
-	lock_guard<mutex> lock(transaction_lock);
+	unique_lock<mutex> lock(transaction_lock);
+	if (unsynced_commits > 0) {
+		// commits become visible to the transactions that start after them - wait until they are durable
+		commits_synced.wait(lock, [&]() { return unsynced_commits == 0; });
+		auto &db_instance = db.GetDatabase();
+		if (ValidChecker::IsInvalidated(db_instance)) {
+			// a commit failed to sync while we were waiting
+			throw ErrorManager::InvalidatedDatabase(context, ValidChecker::InvalidatedMessage(db_instance));
+		}
+	}
 	if (current_start_timestamp >= TRANSACTION_ID_START) { // LCOV_EXCL_START
 		throw InternalException("Cannot start more transactions, ran out of "
 		                        "transaction identifiers!");
@@ -196,6 +208,104 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
 	}
 	storage_manager.CreateCheckpoint(options);
+
+	// the checkpoint succeeded - we no longer have to retry a failed background checkpoint in the foreground
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	background_checkpoint_error = ErrorData();
+}
+
+bool DuckTransactionManager::UseBackgroundCheckpoints() {
+#ifdef DUCKDB_NO_THREADS
+	return false;
+#else
+	auto &config = DBConfig::GetConfig(db.GetDatabase());
+	if (!config.options.background_checkpoint) {
+		return false;
+	}
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (background_checkpoint_error.HasError()) {
+		// the last background checkpoint failed: perform this checkpoint in the foreground instead, so that the
+		// committing client sees its error (if the checkpoint still fails)
+		background_checkpoint_error = ErrorData();
+		return false;
+	}
+	return true;
+#endif
+}
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (background_checkpoint_stopped) {
+		return;
+	}
+	background_checkpoint_requested = true;
+	if (!background_checkpoint_thread) {
+		background_checkpoint_thread = make_uniq<thread>([this]() { BackgroundCheckpointThread(); });
+	}
+	background_checkpoint_cv.notify_one();
+#endif
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+#ifndef DUCKDB_NO_THREADS
+	unique_ptr<thread> checkpoint_thread;
+	{
+		lock_guard<mutex> guard(background_checkpoint_lock);
+		background_checkpoint_stopped = true;
+		checkpoint_thread = std::move(background_checkpoint_thread);
+		background_checkpoint_cv.notify_one();
+	}
+	if (checkpoint_thread) {
+		checkpoint_thread->join();
+	}
+#endif
+}
+
+void DuckTransactionManager::BackgroundCheckpointThread() {
+	while (true) {
+		{
+			unique_lock<mutex> guard(background_checkpoint_lock);
+			background_checkpoint_cv.wait(
+			    guard, [&]() { return background_checkpoint_requested || background_checkpoint_stopped; });
+			if (background_checkpoint_stopped) {
+				return;
+			}
+			background_checkpoint_requested = false;
+		}
+		try {
+			TryBackgroundCheckpoint();
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (Exception::InvalidatesDatabase(error.Type())) {
+				// the checkpoint failed half-way, e.g., because of an internal error - we cannot continue
+				// invalidate the database, as the failed query would if the checkpoint was performed in the foreground
+				ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+				return;
+			}
+			// other errors (e.g., I/O errors or running out of memory) leave the database usable, and the checkpoint
+			// can be retried - the next automatic checkpoint is performed by the committing client, which sees the
+			// error if it persists
+			lock_guard<mutex> guard(background_checkpoint_lock);
+			background_checkpoint_error = std::move(error);
+		}
+	}
+}
+
+void DuckTransactionManager::TryBackgroundCheckpoint() {
+	// we yield to write transactions: if any are active, they request another checkpoint when they commit
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return;
+	}
+	CheckpointOptions options;
+	options.action = CheckpointAction::CHECKPOINT_IF_REQUIRED;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	auto &storage_manager = db.GetStorageManager();
+	storage_manager.CreateCheckpoint(options);
 }
 
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
@@ -228,6 +338,13 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
+	bool background_checkpoint = false;
+	if (checkpoint_decision.can_checkpoint && UseBackgroundCheckpoints()) {
+		// leave the checkpoint to the background checkpoint thread, so that the commit does not stall
+		checkpoint_decision = CheckpointDecision("automatic checkpoints are performed in the background");
+		background_checkpoint = true;
+		lock.reset();
+	}
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
@@ -245,7 +362,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		}
 		// unlock the transaction lock while we write to the WAL
 		tlock.unlock();
-		// grab the WAL lock and hold it until the entire commit is finished
+		// grab the WAL lock and hold it until the commit has been written to the WAL
 		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
 		error = transaction.WriteToWAL(db, commit_state);
 
@@ -256,7 +373,34 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
+	}
+	ErrorData sync_error;
+	if (!error.HasError() && commit_state) {
+		// the commit has been written to the WAL - release the WAL lock and sync the WAL to disk outside of the locks
+		// commits that are written while we sync are synced together by the next commit (group commit)
+		// the transactions that are already active do not see this commit, and new transactions wait in
+		// StartTransaction until it is synced - so the commit is not visible before it is durable
+		unsynced_commits++;
+		held_wal_lock.reset();
+		tlock.unlock();
+		try {
+			commit_state->SyncCommit();
+		} catch (std::exception &ex) {
+			// the WAL might contain the commit, and the commits written after it, but we failed to make it durable
+			// the commit cannot be reverted in memory or in the WAL anymore - we cannot recover from this
+			ErrorData original_error(ex);
+			sync_error =
+			    ErrorData(ExceptionType::FATAL, "Failed to sync the commit to the WAL: " + original_error.RawMessage());
+		}
+		tlock.lock();
+		if (sync_error.HasError()) {
+			// invalidate the database before new transactions can see the commit
+			ValidChecker::Invalidate(db.GetDatabase(), sync_error.RawMessage());
+		}
+		if (--unsynced_commits == 0) {
+			commits_synced.notify_all();
+		}
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -269,6 +413,11 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 			transaction.catalog_version = ++last_committed_version;
 		}
 	}
+	if (sync_error.HasError()) {
+		// the commit was made in memory but could not be made durable - it cannot be rolled back anymore
+		checkpoint_decision = CheckpointDecision(sync_error.Message());
+		error = std::move(sync_error);
+	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
 	if (!checkpoint_decision.can_checkpoint && lock) {
@@ -280,6 +429,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
 	RemoveTransaction(transaction, store_transaction);
+	if (background_checkpoint && !error.HasError()) {
+		ScheduleBackgroundCheckpoint();
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
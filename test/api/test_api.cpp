@@ -448,6 +448,57 @@ TEST_CASE("Test streaming query during stack unwinding", "[api]") {
 	}
 }
 
+TEST_CASE("Test query admission control with an open streaming result", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+	REQUIRE_NO_FAIL(con.Query("SET query_admission_control=true"));
+
+	// queries without a memory limit are admitted with the full memory limit as their budget
+	auto stream_result = con.SendQuery("SELECT * FROM range(1000000)");
+	REQUIRE_NO_FAIL(*stream_result);
+	auto chunk = stream_result->Fetch();
+	REQUIRE(chunk);
+	idx_t count = chunk->size();
+
+	// the open streaming result does not keep the query of the other connection from being admitted
+	auto start = std::chrono::steady_clock::now();
+	auto result = con2.Query("SELECT COUNT(*) FROM range(1000)");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+	auto waited = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+	REQUIRE(waited < 10);
+
+	while (true) {
+		chunk = stream_result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		count += chunk->size();
+	}
+	REQUIRE(count == 1000000);
+}
+
+TEST_CASE("Test query admission control with a pending query", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+	REQUIRE_NO_FAIL(con.Query("SET query_admission_control=true"));
+
+	// a pending query is only admitted when its execution starts
+	auto pending = con.PendingQuery("SELECT SUM(i)::BIGINT FROM range(1000000) t(i)");
+	REQUIRE(!pending->HasError());
+
+	// so the query of the other connection on the same thread does not wait for it
+	auto start = std::chrono::steady_clock::now();
+	auto result = con2.Query("SELECT 42");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+	auto waited = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+	REQUIRE(waited < 10);
+
+	auto pending_result = pending->Execute();
+	REQUIRE(CHECK_COLUMN(pending_result, 0, {Value::BIGINT(499999500000)}));
+}
+
 TEST_CASE("Test prepare dependencies with multiple connections", "[catalog]") {
 	duckdb::unique_ptr<QueryResult> result;
 	DuckDB db(nullptr);
@@ -3,6 +3,9 @@
 #include "test_helpers.hpp"
 #include "duckdb/main/appender.hpp"
 
+#include <chrono>
+#include <thread>
+
 using namespace duckdb;
 using namespace std;
 
@@ -74,3 +77,32 @@ TEST_CASE("Test interleaving of insertions/updates/deletes on multiple tables",
 	}
 	DeleteDatabase(storage_database);
 }
+
+TEST_CASE("Test a background checkpoint that fails with a fatal error", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("background_checkpoint_fatal");
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("SET background_checkpoint=true"));
+		REQUIRE_NO_FAIL(con.Query("SET checkpoint_threshold='1KB'"));
+		REQUIRE_NO_FAIL(con.Query("SET debug_checkpoint_abort='before_header'"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test AS SELECT * FROM range(10000) t(i)"));
+
+		// the commit succeeds, but the automatic checkpoint that it requests fails in the background
+		// the error is not swallowed: it invalidates the database as it would for a checkpoint in the foreground
+		bool invalidated = false;
+		for (idx_t i = 0; i < 1000 && !invalidated; i++) {
+			auto result = con.Query("SELECT 42");
+			if (result->HasError()) {
+				REQUIRE(StringUtil::Contains(result->GetError(), "Checkpoint aborted before header write"));
+				invalidated = true;
+			} else {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		}
+		REQUIRE(invalidated);
+	}
+	DeleteDatabase(storage_database);
+}